@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+// 各ブロックの前に大きさを置く(reallocでコピーする長さに使う)
+#define ARENA_ALIGN 16
+#define ARENA_HEADER ARENA_ALIGN
+
+#define align_up(n) (((n) + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1))
+
+int nano_arena_init(struct nano_arena *a, size_t size)
+{
+	memset(a, 0, sizeof(*a));
+	return nano_arena_reset(a, size);
+}
+
+void nano_arena_free(struct nano_arena *a)
+{
+	free(a->base);
+	a->base = NULL;
+	a->size = a->used = 0;
+}
+
+int nano_arena_reset(struct nano_arena *a, size_t size)
+{
+	size = align_up(size);
+	if(size > a->size) {
+		char *base = malloc(size);
+		if(!base) return 0;
+		free(a->base);
+		a->base = base;
+		a->size = size;
+	}
+	a->used = 0;
+	a->peak = 0;
+	a->overflow = 0;
+	a->last = (size_t)-1;
+	return 1;
+}
+
+static int in_arena(const struct nano_arena *a, const void *p)
+{
+	const char *c = p;
+	return a->base && c >= a->base && c < a->base + a->size;
+}
+
+void *nano_arena_alloc(struct nano_arena *a, size_t size)
+{
+	size_t need = ARENA_HEADER + align_up(size);
+
+	if(a->size - a->used < need) {
+		a->overflow += size;
+		return malloc(size);
+	}
+
+	char *h = a->base + a->used;
+	*(size_t *)h = size;
+	a->last = a->used;
+	a->used += need;
+	if(a->used > a->peak) a->peak = a->used;
+	return h + ARENA_HEADER;
+}
+
+void *nano_arena_realloc(struct nano_arena *a, void *p, size_t size)
+{
+	if(!p) return nano_arena_alloc(a, size);
+
+	if(!in_arena(a, p)) {
+		a->overflow += size;
+		return realloc(p, size);
+	}
+
+	char *h = (char *)p - ARENA_HEADER;
+	size_t old = *(size_t *)h;
+
+	// 最後のブロックならその場で伸ばす
+	if((size_t)(h - a->base) == a->last) {
+		size_t end = a->last + ARENA_HEADER + align_up(size);
+		if(end <= a->size) {
+			*(size_t *)h = size;
+			a->used = end;
+			if(a->used > a->peak) a->peak = a->used;
+			return p;
+		}
+	}
+
+	void *q = nano_arena_alloc(a, size);
+	if(q) memcpy(q, p, old < size ? old : size);
+	return q;
+}
+
+void nano_arena_release(struct nano_arena *a, void *p)
+{
+	if(p && !in_arena(a, p)) free(p);
+}
@@ -0,0 +1,30 @@
+#ifndef NANOTODON_ARENA_H
+#define NANOTODON_ARENA_H
+
+#include <stddef.h>
+
+// 積み上げ式のメモリ領域(sjsonのalloc_user用)
+// 確保は先頭から積むだけで,個別の解放はしない(nano_arena_resetでまとめて戻す)
+// 入りきらない分はmallocに回し,overflowに数える
+struct nano_arena {
+	char *base;
+	size_t size;
+	size_t used;
+	size_t peak;		// resetまでの最大使用量
+	size_t overflow;	// 領域外にmallocしたバイト数
+	size_t last;		// 最後に確保したブロックの位置(その場でのreallocに使う)
+};
+
+int nano_arena_init(struct nano_arena *a, size_t size);
+void nano_arena_free(struct nano_arena *a);
+
+// 使用量を0に戻す,sizeが今より大きければ確保し直す
+int nano_arena_reset(struct nano_arena *a, size_t size);
+
+void *nano_arena_alloc(struct nano_arena *a, size_t size);
+void *nano_arena_realloc(struct nano_arena *a, void *p, size_t size);
+
+// 領域内のポインタなら何もしない,領域外(malloc分)ならfreeする
+void nano_arena_release(struct nano_arena *a, void *p);
+
+#endif
@@ -0,0 +1,149 @@
+// Tootの本文のHTMLを表示用の文字列にする速さ(html.c)
+// 合成したストリームのTootの本文を,nano_html_parseと以前の描画時のループ(比較用にここに残す)で変換する
+#include <string.h>
+#include "tests/common.h"
+#include "sse.h"
+#include "html.h"
+#include "sjson.h"
+
+#define STREAM_PATH "bench/data/stream.sse"
+
+struct contents {
+	sjson_context *ctx;
+	char **html;
+	size_t *len;
+	size_t count, cap, bytes;
+};
+
+// updateイベントのTootの本文を取っておく
+static void keep_content(struct nano_sse_event *ev, void *user)
+{
+	struct contents *c = user;
+	sjson_node *status, *content;
+
+	if(strcmp(ev->type, "update")) return;
+	status = sjson_decode(c->ctx, ev->data);
+	content = sjson_find_member(status, "content");
+	if(!content || content->tag != SJSON_STRING) return;
+	if(c->count >= c->cap) {
+		c->cap = c->cap ? c->cap * 2 : 64;
+		c->html = realloc(c->html, sizeof(char *) * c->cap);
+		c->len = realloc(c->len, sizeof(size_t) * c->cap);
+	}
+	c->html[c->count] = strdup(content->string_);
+	c->len[c->count] = strlen(content->string_);
+	c->bytes += c->len[c->count];
+	c->count++;
+}
+
+// 以前render_statusにあったループ(タグを消し,6つの文字参照だけを展開する)をバッファに書くようにしたもの
+static size_t old_strip_tags(const char *src, char *out)
+{
+	char *o = out;
+	int ltgt = 0;
+	int pcount = 0;
+
+	while(*src) {
+		if(*src == '<') ltgt = 1;
+
+		if(ltgt && strncmp(src, "<br", 3) == 0) *o++ = '\n';
+		if(ltgt && strncmp(src, "<p", 2) == 0) {
+			pcount++;
+			if(pcount >= 2) {
+				*o++ = '\n';
+				*o++ = '\n';
+			}
+		}
+
+		if(!ltgt) {
+			if(*src == '&') {
+				if(strncmp(src, "&amp;", 5) == 0) {
+					*o++ = '&';
+					src += 4;
+				}
+				else if(strncmp(src, "&lt;", 4) == 0) {
+					*o++ = '<';
+					src += 3;
+				}
+				else if(strncmp(src, "&gt;", 4) == 0) {
+					*o++ = '>';
+					src += 3;
+				}
+				else if(strncmp(src, "&quot;", 6) == 0) {
+					*o++ = '\"';
+					src += 5;
+				}
+				else if(strncmp(src, "&apos;", 6) == 0) {
+					*o++ = '\'';
+					src += 5;
+				}
+				else if(strncmp(src, "&#39;", 5) == 0) {
+					*o++ = '\'';
+					src += 4;
+				}
+			} else {
+				*o++ = *src;
+			}
+		}
+		if(*src == '>') ltgt = 0;
+		src++;
+	}
+	*o = 0;
+	return o - out;
+}
+
+int main(void)
+{
+	size_t len, spans = 0, max = 0;
+	char *stream = common_load(STREAM_PATH, &len), *buf;
+	struct nano_sse_parser sse;
+	struct contents c = { NULL, NULL, NULL, 0, 0, 0 };
+	volatile size_t sink = 0;
+
+	if(!stream) return 1;
+	c.ctx = sjson_create_context(0, 0, NULL);
+	nano_sse_init(&sse, keep_content, &c);
+	nano_sse_feed(&sse, stream, len);
+	nano_sse_free(&sse);
+	sjson_destroy_context(c.ctx);
+	if(c.count == 0) return 1;
+
+	for(size_t i = 0; i < c.count; i++) {
+		struct nano_html *h = nano_html_parse(c.html[i], c.len[i]);
+		if(!h) {
+			fprintf(stderr, "toot %zu: nano_html_parse failed\n", i);
+			return 1;
+		}
+		spans += h->nspans;
+		nano_html_free(h);
+		if(c.len[i] > max) max = c.len[i];
+	}
+	buf = malloc(max * 2 + 1);
+	printf("%s: %zu toots, %zu bytes of content, %zu spans\n", STREAM_PATH, c.count, c.bytes, spans);
+
+	for(int impl = 0; impl < 2; impl++) {
+		unsigned long long passes = 0;
+		uint64_t elapsed = 0;
+
+		COMMON_REPEAT(passes, elapsed, {
+			for(size_t i = 0; i < c.count; i++) {
+				if(impl == 0) {
+					struct nano_html *h = nano_html_parse(c.html[i], c.len[i]);
+					sink += h->len;
+					nano_html_free(h);
+				} else {
+					sink += old_strip_tags(c.html[i], buf);
+				}
+			}
+		});
+		printf("%-26s %7.1f MB/s  %6.1f ns/toot\n", impl == 0 ? "nano_html_parse" : "old loop (tags, 6 entities)",
+			(double)c.bytes * passes / (elapsed / 1e9) / 1e6, common_ns_per(elapsed, passes * c.count));
+	}
+
+	for(size_t i = 0; i < c.count; i++) free(c.html[i]);
+	free(c.html);
+	free(c.len);
+	free(buf);
+	free(stream);
+	return 0;
+}
@@ -0,0 +1,93 @@
+// sjsonのオブジェクトのキー検索の速さ,線形探索とキーの索引(sjson_index_objects)を比べる
+// 合成したストリームの最初のTootをDOMにして,nanotodonが読むキーを引く
+#include <string.h>
+#include "tests/common.h"
+#include "sse.h"
+#include "jsonpath.h"
+
+#define STREAM_PATH "bench/data/stream.sse"
+
+// 引くキー(statusの最上位)
+static const struct nano_json_field fields[] = {
+	{ "id", 0 },
+	{ "created_at", 1 },
+	{ "spoiler_text", 2 },
+	{ "visibility", 3 },
+	{ "content", 4 },
+	{ "reblog", 5 },
+	{ "application", 6 },
+	{ "account", 7 },
+	{ "media_attachments", 8 },
+	{ "poll", 9 },
+};
+#define NFIELDS (int)(sizeof(fields) / sizeof(fields[0]))
+
+// 最初のupdateイベントのdataを複製する
+static void keep_first_update(struct nano_sse_event *ev, void *user)
+{
+	char **json = user;
+	if(!*json && !strcmp(ev->type, "update")) *json = strdup(ev->data);
+}
+
+int main(void)
+{
+	size_t len;
+	char *stream = common_load(STREAM_PATH, &len), *json = NULL;
+	struct nano_sse_parser sse;
+	struct nano_json_schema schema;
+	volatile uintptr_t sink = 0;
+
+	if(!stream) return 1;
+	nano_sse_init(&sse, keep_first_update, &json);
+	nano_sse_feed(&sse, stream, len);
+	nano_sse_free(&sse);
+	if(!json) {
+		fprintf(stderr, "%s: no update event\n", STREAM_PATH);
+		return 1;
+	}
+	nano_json_schema_compile(&schema, fields, NFIELDS);
+
+	for(int indexed = 0; indexed < 2; indexed++) {
+		sjson_context *ctx = sjson_create_context(0, 0, NULL);
+		sjson_node *status, *out[NFIELDS];
+		unsigned long long passes = 0;
+		uint64_t elapsed = 0;
+
+		sjson_index_objects(ctx, indexed);
+		status = sjson_decode(ctx, json);
+		if(!status || status->tag != SJSON_OBJECT) return 1;
+		for(int f = 0; f < NFIELDS; f++) {
+			if(!sjson_find_member(status, fields[f].path)) {
+				fprintf(stderr, "no \"%s\"\n", fields[f].path);
+				return 1;
+			}
+		}
+		if(!indexed) printf("%s: first status, %d keys, %d lookups each\n", STREAM_PATH, status->count, NFIELDS);
+		printf("%s\n", indexed ? "key index" : "linear search");
+
+		// キー1つずつ
+		COMMON_REPEAT(passes, elapsed, {
+			for(int i = 0; i < 1000; i++) {
+				for(int f = 0; f < NFIELDS; f++) sink += (uintptr_t)sjson_find_member(status, fields[f].path);
+			}
+		});
+		printf("  sjson_find_member  %6.1f M lookups/s  %6.1f ns/lookup\n",
+			passes * 1000 * NFIELDS / (elapsed / 1e9) / 1e6, common_ns_per(elapsed, passes * 1000 * NFIELDS));
+
+		// スキーマでまとめて
+		passes = elapsed = 0;
+		COMMON_REPEAT(passes, elapsed, {
+			for(int i = 0; i < 1000; i++) {
+				nano_json_extract(&schema, status, out);
+				sink += (uintptr_t)out[NFIELDS - 1];
+			}
+		});
+		printf("  nano_json_extract  %6.1f ns/status\n", common_ns_per(elapsed, passes * 1000));
+
+		sjson_destroy_context(ctx);
+	}
+
+	free(json);
+	free(stream);
+	return 0;
+}
@@ -0,0 +1,155 @@
+// Tootを1件ずつ描いたときのcursesの呼び出し回数と端末へ出るバイト数
+// 描画に使うcursesの関数を数える版に差し替えてnanotodon.cを取り込み,端末の出力は一時ファイルに向ける
+// 1フレームに1件ずつ届く(フレームにまとめられない)場合を測る
+#include <string.h>
+#include <locale.h>
+#include <curses.h>
+
+// 数えるcursesの呼び出し
+enum {
+	CALL_WADDNSTR,
+	CALL_WMOVE,
+	CALL_WATTRSET,
+	CALL_WSCRL,
+	CALL_WERASE,
+	CALL_OTHER,		// scrollok,wnoutrefresh,doupdate
+	CALLS
+};
+
+static const char *call_names[CALLS] = { "waddnstr", "wmove", "wattrset", "wscrl", "werase", "other" };
+static unsigned long long calls[CALLS];
+
+static int count_waddnstr(WINDOW *w, const char *s, int n) { calls[CALL_WADDNSTR]++; return waddnstr(w, s, n); }
+static int count_wmove(WINDOW *w, int y, int x) { calls[CALL_WMOVE]++; return wmove(w, y, x); }
+static int count_wattrset(WINDOW *w, int attr) { calls[CALL_WATTRSET]++; return wattrset(w, attr); }
+static int count_wscrl(WINDOW *w, int n) { calls[CALL_WSCRL]++; return wscrl(w, n); }
+static int count_werase(WINDOW *w) { calls[CALL_WERASE]++; return werase(w); }
+static int count_scrollok(WINDOW *w, bool b) { calls[CALL_OTHER]++; return scrollok(w, b); }
+static int count_wnoutrefresh(WINDOW *w) { calls[CALL_OTHER]++; return wnoutrefresh(w); }
+static int count_doupdate(void) { calls[CALL_OTHER]++; return doupdate(); }
+
+#undef waddnstr
+#undef wmove
+#undef wattrset
+#undef wscrl
+#undef werase
+#undef scrollok
+#undef wnoutrefresh
+#undef doupdate
+#define waddnstr count_waddnstr
+#define wmove count_wmove
+#define wattrset count_wattrset
+#define wscrl count_wscrl
+#define werase count_werase
+#define scrollok count_scrollok
+#define wnoutrefresh count_wnoutrefresh
+#define doupdate count_doupdate
+
+#define COMMON_NANOTODON
+#include "tests/common.h"
+
+#define STREAM_PATH "bench/data/stream.sse"
+
+// 描くTootの数と画面の大きさ(TL用Windowは上の6行を除いた分)
+#define FRAMES 400
+#define SCREEN_COLS 80
+#define SCREEN_LINES 40
+
+// 合成したストリームのイベントをパースする(レコードはUIキューに溜まる)
+static void parse_sse_event(struct nano_sse_event *sse, void *user)
+{
+	struct raw_event ev;
+	ev.kind = RAW_STREAM;
+	snprintf(ev.type, sizeof(ev.type), "%s", sse->type);
+	ev.data = sse->data;
+	ev.len = sse->data_len;
+	parse_raw_event(&ev);
+}
+
+int main(void)
+{
+	size_t len, nstatus = 0;
+	char *stream = common_load(STREAM_PATH, &len);
+	struct nano_status **statuses;
+	struct nano_record *rec;
+	struct nano_sse_parser sse;
+	unsigned long long total = 0;
+	uint64_t elapsed = 0;
+	long bytes;
+	FILE *out, *in;
+	SCREEN *screen;
+
+	if(!stream) return 1;
+
+	// 合成したストリームからTootを取り出しておく
+	common_parse_init();
+	nano_sse_init(&sse, parse_sse_event, NULL);
+	nano_sse_feed(&sse, stream, len);
+	nano_sse_free(&sse);
+	statuses = malloc(sizeof(struct nano_status *) * nano_queue_depth(&ui_queue));
+	while((rec = nano_queue_pop(&ui_queue)) != NULL) {
+		if(rec->kind == NANO_RECORD_STATUS) {
+			statuses[nstatus++] = rec->status;
+			rec->status = NULL;
+		}
+		nano_record_free(rec);
+	}
+	if(nstatus == 0) return 1;
+
+	// 端末の代わりに一時ファイルへ出す
+	if(!setlocale(LC_ALL, "") || !strstr(setlocale(LC_ALL, NULL), "UTF-8")) setlocale(LC_ALL, "C.UTF-8");
+	setenv("LINES", "40", 1);
+	setenv("COLUMNS", "80", 1);
+	out = tmpfile();
+	in = fopen("/dev/null", "r");
+	screen = newterm("xterm-256color", out, in);
+	if(!screen) {
+		fprintf(stderr, "newterm failed (no xterm-256color terminfo?)\n");
+		return 1;
+	}
+	start_color();
+	use_default_colors();
+	init_pair(1, COLOR_GREEN, -1);
+	init_pair(2, COLOR_CYAN, -1);
+	init_pair(3, COLOR_YELLOW, -1);
+	init_pair(4, COLOR_RED, -1);
+	init_pair(5, COLOR_BLUE, -1);
+	term_w = SCREEN_COLS;
+	term_h = SCREEN_LINES;
+	scr = newwin(term_h - 6, term_w, 6, 0);
+	pad = newwin(5, term_w, 0, 0);
+	nano_timeline_init(&timeline, TIMELINE_MAX);
+	doupdate();
+	fflush(out);
+	bytes = ftell(out);
+	memset(calls, 0, sizeof(calls));
+
+	// 1フレームに1件ずつ
+	for(int i = 0; i < FRAMES; i++) {
+		uint64_t t;
+		rec = malloc(sizeof(struct nano_record));
+		rec->kind = NANO_RECORD_STATUS;
+		rec->stream = NULL;
+		rec->status = nano_status_dup(statuses[i % nstatus]);
+		nano_queue_push(&ui_queue, rec);
+
+		t = common_now();
+		render_pending_records();
+		render_flush();
+		elapsed += common_now() - t;
+	}
+	fflush(out);
+	bytes = ftell(out) - bytes;
+
+	for(int i = 0; i < CALLS; i++) total += calls[i];
+	printf("%s: %d toots (%zu distinct) one per frame into a %dx%d window\n", STREAM_PATH, FRAMES, nstatus, SCREEN_COLS, SCREEN_LINES - 6);
+	printf("curses calls: %6.1f /toot (", (double)total / FRAMES);
+	for(int i = 0; i < CALLS; i++) printf("%s%s %.1f", i ? ", " : "", call_names[i], (double)calls[i] / FRAMES);
+	printf(")\n");
+	printf("terminal:     %6.1f bytes/toot\n", (double)bytes / FRAMES);
+	printf("time:         %6.1f us/toot\n", common_ns_per(elapsed, FRAMES) / 1000);
+
+	endwin();
+	delscreen(screen);
+	return 0;
+}
@@ -0,0 +1,74 @@
+// SSEパーサ(sse.c)の速さ
+// 合成したストリーム(tests/mkdata.pyで作る)を受信チャンクの大きさごとに区切って流し込み,イベントごとのハンドラ呼び出しまでを測る
+#include <string.h>
+#include "tests/common.h"
+#include "sse.h"
+
+#define STREAM_PATH "bench/data/stream.sse"
+
+// curlから渡される大きさの目安(TCPの1セグメント,curlの既定のバッファ)と極端に小さい場合
+static const size_t chunk_sizes[] = { 64, 1448, 16384 };
+
+struct sse_count {
+	unsigned long long events;
+	unsigned long long data_bytes;
+};
+
+static void count_event(struct nano_sse_event *ev, void *user)
+{
+	struct sse_count *c = user;
+	c->events++;
+	c->data_bytes += ev->data_len;
+}
+
+// ストリームを1回分流す
+static void feed_stream(struct nano_sse_parser *p, const char *stream, size_t len, size_t chunk)
+{
+	for(size_t off = 0; off < len; off += chunk) {
+		nano_sse_feed(p, stream + off, len - off < chunk ? len - off : chunk);
+	}
+}
+
+int main(void)
+{
+	size_t len;
+	char *stream = common_load(STREAM_PATH, &len);
+	unsigned long long per_pass;
+
+	if(!stream) return 1;
+
+	// 1回流したときのイベント数(これと合わなければ壊れている)
+	{
+		struct nano_sse_parser p;
+		struct sse_count c = { 0, 0 };
+		nano_sse_init(&p, count_event, &c);
+		feed_stream(&p, stream, len, len);
+		nano_sse_free(&p);
+		per_pass = c.events;
+		printf("%s: %zu bytes, %llu events, %llu bytes of data\n", STREAM_PATH, len, c.events, c.data_bytes);
+	}
+
+	for(size_t i = 0; i < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); i++) {
+		struct nano_sse_parser p;
+		struct sse_count c = { 0, 0 };
+		unsigned long long passes = 0;
+		uint64_t elapsed = 0;
+
+		nano_sse_init(&p, count_event, &c);
+		feed_stream(&p, stream, len, chunk_sizes[i]);	// 慣らし(バッファを伸ばしきる)
+		c.events = 0;
+
+		COMMON_REPEAT(passes, elapsed, feed_stream(&p, stream, len, chunk_sizes[i]));
+		nano_sse_free(&p);
+
+		if(c.events != per_pass * passes) {
+			printf("chunk %5zu: %llu events, expected %llu\n", chunk_sizes[i], c.events, per_pass * passes);
+			return 1;
+		}
+		printf("chunk %5zu: %8.1f MB/s  %7.1f ns/event\n", chunk_sizes[i],
+			(double)len * passes / (elapsed / 1e9) / 1e6, common_ns_per(elapsed, c.events));
+	}
+
+	free(stream);
+	return 0;
+}
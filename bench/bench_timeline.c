@@ -0,0 +1,80 @@
+// 取得したタイムラインのページを読む速さを,デコードのワーカープールの大きさごとに測る
+// 合成したストリームのTootを並べて1ページ(Mastodonの既定の40件)にし,nanotodon.cのparse_timelineに読ませる
+#include <string.h>
+
+#define COMMON_NANOTODON
+#include "tests/common.h"
+
+#define STREAM_PATH "bench/data/stream.sse"
+
+#define PAGE_STATUSES 40
+
+static const int pool_sizes[] = { 1, 2, 4, 8 };
+
+struct page {
+	char *json;
+	size_t len, cap;
+	int count;
+};
+
+// updateイベントのTootをページの配列に足す
+static void add_update(struct nano_sse_event *ev, void *user)
+{
+	struct page *pg = user;
+
+	if(pg->count >= PAGE_STATUSES || strcmp(ev->type, "update")) return;
+	if(pg->len + ev->data_len + 3 > pg->cap) {
+		pg->cap = (pg->len + ev->data_len + 3) * 2;
+		pg->json = realloc(pg->json, pg->cap);
+	}
+	pg->json[pg->len++] = pg->count++ ? ',' : '[';
+	memcpy(pg->json + pg->len, ev->data, ev->data_len);
+	pg->len += ev->data_len;
+}
+
+int main(void)
+{
+	size_t len;
+	char *stream = common_load(STREAM_PATH, &len);
+	struct nano_sse_parser sse;
+	struct page pg = { NULL, 0, 0, 0 };
+
+	if(!stream) return 1;
+	nano_sse_init(&sse, add_update, &pg);
+	nano_sse_feed(&sse, stream, len);
+	nano_sse_free(&sse);
+	if(pg.count == 0) return 1;
+	pg.json[pg.len++] = ']';
+	pg.json[pg.len] = 0;
+
+	common_parse_init();
+
+	printf("%s: %d statuses in a %zu-byte page, %d CPUs online\n", STREAM_PATH, pg.count, pg.len, nano_pool_cpus(64));
+
+	for(size_t s = 0; s < sizeof(pool_sizes) / sizeof(pool_sizes[0]); s++) {
+		unsigned long long pages = 0;
+		uint64_t elapsed = 0;
+
+		nano_pool_init(&parse_pool, pool_sizes[s]);
+		do {
+			uint64_t t;
+			// 同じページを何度も読むので,表示済みのIDとして捨てられないように毎回忘れる
+			nano_seen_clear(&seen_ids);
+			t = common_now();
+			parse_timeline(pg.json, pg.len);
+			elapsed += common_now() - t;
+			if(common_drain_records() != pg.count) {
+				printf("%d threads: expected %d records\n", pool_sizes[s], pg.count);
+				return 1;
+			}
+			pages++;
+		} while(elapsed < COMMON_MIN_NS);
+		nano_pool_free(&parse_pool);
+
+		printf("%d threads: %7.0f pages/s  %7.1f us/page\n", pool_sizes[s], pages / (elapsed / 1e9), common_ns_per(elapsed, pages) / 1000);
+	}
+
+	free(pg.json);
+	free(stream);
+	return 0;
+}
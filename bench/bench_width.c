@@ -0,0 +1,86 @@
+// 文字の表示幅(width.c)の速さをglibcのwcwidth/wcswidthと比べる
+// コードポイント1つずつと,UTF-8の文字列全体(wcswidthはmbstowcsでワイド文字にする分も含める)を測る
+#define _XOPEN_SOURCE 700	// wcwidth
+#include <string.h>
+#include <locale.h>
+#include <wchar.h>
+#include "tests/common.h"
+#include "width.h"
+
+#define CODEPOINTS 4096
+
+// 日本語,英語,絵文字(ZWJ,肌の色,国旗,VS16)の混じったToot本文くらいのもの
+static const char *strings[] = {
+	"nanotodon: a tiny Mastodon client for the terminal. Written in C99 and runs on NetBSD/m68k too.",
+	"\xe4\xbb\x8a\xe6\x97\xa5\xe3\x81\xaf\xe3\x81\x84\xe3\x81\x84\xe5\xa4\xa9\xe6\xb0\x97\xe3\x81\xa7\xe3\x81\x99\xe3\x81\xad\xe3\x80\x82"
+	"Mastodon\xe3\x81\xa7\xe3\x83\x88\xe3\x82\xa5\xe3\x83\xbc\xe3\x83\x88\xe3\x81\x97\xe3\x81\xbe\xe3\x81\x97\xe3\x81\x9f "
+	"\xf0\x9f\x98\x80\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd \xf0\x9f\x87\xaf\xf0\x9f\x87\xb5 \xe2\x9d\xa4\xef\xb8\x8f "
+	"\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7 #nanotodon https://example.com/@user",
+};
+
+// ASCII,ラテン文字,かな漢字,絵文字をだいたい同じ割合で
+static void random_codepoints(uint32_t *cps, int n)
+{
+	static const uint32_t ranges[][2] = {
+		{ 0x20, 0x7E }, { 0xA0, 0x24F }, { 0x3040, 0x30FF }, { 0x4E00, 0x9FFF }, { 0x1F300, 0x1F64F },
+	};
+	uint32_t seed = 1;
+
+	for(int i = 0; i < n; i++) {
+		seed = seed * 1103515245 + 12345;
+		int r = (seed >> 16) % 5;
+		seed = seed * 1103515245 + 12345;
+		cps[i] = ranges[r][0] + (seed >> 8) % (ranges[r][1] - ranges[r][0] + 1);
+	}
+}
+
+int main(void)
+{
+	static uint32_t cps[CODEPOINTS];
+	static wchar_t wcs[1024];
+	volatile long sink = 0;
+
+	if(!setlocale(LC_CTYPE, "C.UTF-8") && !setlocale(LC_CTYPE, "en_US.UTF-8")) {
+		fprintf(stderr, "no UTF-8 locale\n");
+		return 1;
+	}
+
+	// コードポイント1つずつ
+	random_codepoints(cps, CODEPOINTS);
+	for(int impl = 0; impl < 2; impl++) {
+		unsigned long long passes = 0;
+		uint64_t elapsed = 0;
+		COMMON_REPEAT(passes, elapsed, {
+			long sum = 0;
+			if(impl == 0) {
+				for(int i = 0; i < CODEPOINTS; i++) sum += nano_cp_width(cps[i]);
+			} else {
+				for(int i = 0; i < CODEPOINTS; i++) sum += wcwidth(cps[i]);
+			}
+			sink += sum;
+		});
+		printf("%-28s %7.2f ns/code point\n", impl == 0 ? "nano_cp_width" : "wcwidth", common_ns_per(elapsed, passes * CODEPOINTS));
+	}
+
+	// 文字列全体
+	for(size_t s = 0; s < sizeof(strings) / sizeof(strings[0]); s++) {
+		size_t len = strlen(strings[s]);
+		printf("%zu-byte string, width %d (wcswidth %d)\n", len, nano_str_width(strings[s]),
+			wcswidth(wcs, mbstowcs(wcs, strings[s], sizeof(wcs) / sizeof(wcs[0]))));
+		for(int impl = 0; impl < 2; impl++) {
+			unsigned long long passes = 0;
+			uint64_t elapsed = 0;
+			COMMON_REPEAT(passes, elapsed, {
+				for(int i = 0; i < 1000; i++) {
+					if(impl == 0) {
+						sink += nano_str_width(strings[s]);
+					} else {
+						sink += wcswidth(wcs, mbstowcs(wcs, strings[s], sizeof(wcs) / sizeof(wcs[0])));
+					}
+				}
+			});
+			printf("  %-26s %7.1f ns/string\n", impl == 0 ? "nano_str_width" : "mbstowcs + wcswidth", common_ns_per(elapsed, passes * 1000));
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <string.h>
+#include "datetime.h"
+
+// 1970-01-01からの日数(グレゴリオ暦)
+static long days_from_civil(long y, int m, int d)
+{
+	long era, yoe, doy, doe;
+
+	y -= m <= 2;
+	era = (y >= 0 ? y : y - 399) / 400;
+	yoe = y - era * 400;
+	doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+// 数字n桁を読む
+static int digits(const char *s, int n, int *v)
+{
+	*v = 0;
+	for(int i = 0; i < n; i++) {
+		if(s[i] < '0' || s[i] > '9') return 0;
+		*v = *v * 10 + (s[i] - '0');
+	}
+	return 1;
+}
+
+int nano_datetime_parse(const char *s, time_t *t, int *ms)
+{
+	int y, mo, d, h, mi, sec, frac = 0;
+	long offset = 0;
+	const char *p;
+
+	*t = 0;
+	*ms = 0;
+	if(!digits(s, 4, &y) || s[4] != '-' || !digits(s + 5, 2, &mo) || s[7] != '-' ||
+	   !digits(s + 8, 2, &d) || (s[10] != 'T' && s[10] != 't' && s[10] != ' ') ||
+	   !digits(s + 11, 2, &h) || s[13] != ':' || !digits(s + 14, 2, &mi) || s[16] != ':' ||
+	   !digits(s + 17, 2, &sec)) return 0;
+	if(mo < 1 || mo > 12 || d < 1 || d > 31 || h > 23 || mi > 59 || sec > 60) return 0;
+	p = s + 19;
+
+	// 秒未満は上から3桁だけ使う
+	if(*p == '.') {
+		int n = 0;
+		for(p++; *p >= '0' && *p <= '9'; p++, n++) {
+			if(n < 3) frac = frac * 10 + (*p - '0');
+		}
+		if(n == 0) return 0;
+		for(; n < 3; n++) frac *= 10;
+	}
+
+	if(*p == '+' || *p == '-') {
+		int oh, om;
+		if(!digits(p + 1, 2, &oh)) return 0;
+		if(p[3] == ':') {
+			if(!digits(p + 4, 2, &om)) return 0;
+		} else if(!digits(p + 3, 2, &om)) {
+			om = 0;
+		}
+		offset = (oh * 60L + om) * 60;
+		if(*p == '-') offset = -offset;
+	} else if(*p != 'Z' && *p != 'z' && *p != '\0') {
+		return 0;
+	}
+
+	*t = (time_t)(days_from_civil(y, mo, d) * 86400L + h * 3600L + mi * 60L + sec - offset);
+	*ms = frac;
+	return 1;
+}
+
+// 地方時の1日分([start, end)のUTC)の時差と日付の部分
+static struct {
+	int valid;
+	time_t start, end;
+	long offset;			// 地方時-UTC(秒)
+	struct tm tm;			// その日の0時
+	char prefix[32];		// "%x(%a) "
+	size_t prefix_len;
+} day;
+
+// "%X"の書式(時,分,秒の2桁が入る位置),24時間制で数字が2桁ずつ並ぶロケールでだけ使う
+static struct {
+	int checked, ok;
+	char text[32];
+	size_t len;
+	int pos[3];
+} clock_tmpl;
+
+static void check_clock(void)
+{
+	struct tm tm;
+	const char *p;
+
+	clock_tmpl.checked = 1;
+	memset(&tm, 0, sizeof(tm));
+	tm.tm_year = 100;
+	tm.tm_mday = 1;
+	tm.tm_hour = 23;
+	tm.tm_min = 45;
+	tm.tm_sec = 56;
+	clock_tmpl.len = strftime(clock_tmpl.text, sizeof(clock_tmpl.text), "%X", &tm);
+	if(clock_tmpl.len == 0) return;
+
+	// どの数も1回だけ現れること
+	static const char *const probe[3] = { "23", "45", "56" };
+	for(int i = 0; i < 3; i++) {
+		p = strstr(clock_tmpl.text, probe[i]);
+		if(!p || strstr(p + 1, probe[i])) return;
+		clock_tmpl.pos[i] = (int)(p - clock_tmpl.text);
+	}
+	clock_tmpl.ok = 1;
+}
+
+// 地方時-UTC(秒)
+static long utc_offset(time_t t, const struct tm *tm)
+{
+	return (long)(days_from_civil(tm->tm_year + 1900L, tm->tm_mon + 1, tm->tm_mday) * 86400L +
+		tm->tm_hour * 3600L + tm->tm_min * 60L + tm->tm_sec - t);
+}
+
+// tを含む日を覚える,夏時間の切り替わる日は覚えずに0を返す(tmにはtの地方時)
+static int load_day(time_t t, struct tm *tm)
+{
+	struct tm end;
+	time_t last;
+
+	day.valid = 0;
+	if(!localtime_r(&t, tm)) {
+		memset(tm, 0, sizeof(*tm));
+		return 0;
+	}
+	day.offset = utc_offset(t, tm);
+	day.start = t - (tm->tm_hour * 3600 + tm->tm_min * 60 + tm->tm_sec);
+	day.end = day.start + 86400;
+
+	// 1日の終わりまで同じ時差でなければ覚えない
+	last = day.end - 1;
+	if(!localtime_r(&last, &end) || utc_offset(last, &end) != day.offset) return 0;
+
+	day.tm = *tm;
+	day.tm.tm_hour = day.tm.tm_min = day.tm.tm_sec = 0;
+	day.prefix_len = strftime(day.prefix, sizeof(day.prefix), "%x(%a) ", tm);
+	if(day.prefix_len == 0) return 0;
+	day.valid = 1;
+	return 1;
+}
+
+size_t nano_datetime_format(char *buf, size_t size, time_t t)
+{
+	struct tm tm;
+	long sec;
+	char *p;
+
+	if(!day.valid || t < day.start || t >= day.end) {
+		if(!load_day(t, &tm)) return strftime(buf, size, "%x(%a) %X", &tm);
+	}
+	if(!clock_tmpl.checked) check_clock();
+
+	sec = (long)(t - day.start);
+	if(!clock_tmpl.ok) {
+		tm = day.tm;
+		tm.tm_hour = (int)(sec / 3600);
+		tm.tm_min = (int)(sec / 60 % 60);
+		tm.tm_sec = (int)(sec % 60);
+		return strftime(buf, size, "%x(%a) %X", &tm);
+	}
+
+	if(day.prefix_len + clock_tmpl.len >= size) {
+		if(size) buf[0] = '\0';
+		return 0;
+	}
+	memcpy(buf, day.prefix, day.prefix_len);
+	p = buf + day.prefix_len;
+	memcpy(p, clock_tmpl.text, clock_tmpl.len + 1);
+
+	int v[3] = { (int)(sec / 3600), (int)(sec / 60 % 60), (int)(sec % 60) };
+	for(int i = 0; i < 3; i++) {
+		p[clock_tmpl.pos[i]] = '0' + v[i] / 10;
+		p[clock_tmpl.pos[i] + 1] = '0' + v[i] % 10;
+	}
+	return day.prefix_len + clock_tmpl.len;
+}
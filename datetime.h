@@ -0,0 +1,17 @@
+#ifndef NANOTODON_DATETIME_H
+#define NANOTODON_DATETIME_H
+
+#include <stddef.h>
+#include <time.h>
+
+// Mastodonの日時("2024-01-02T03:04:05.678Z")を読む
+// 秒未満と時差("+09:00")は省略してもよい,tにUTCの時刻,msにミリ秒を返す
+// 形式が違えば0を返す
+int nano_datetime_parse(const char *s, time_t *t, int *ms);
+
+// tを地方時で"%x(%a) %X"の形に書く,書いたバイト数を返す
+// 時差と日付の部分は日ごとに覚えておくので,同じ日のうちはlocaltimeもstrftimeも呼ばない
+// UIスレッドからだけ呼ぶこと
+size_t nano_datetime_format(char *buf, size_t size, time_t t);
+
+#endif
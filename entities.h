@@ -0,0 +1,2307 @@
+// HTML5の文字参照の表(mkentities.pyで生成,手で編集しない)
+#define NANO_ENTITY_COUNT 2231
+#define NANO_ENTITY_BUCKETS 743
+#define NANO_ENTITY_NAME_MAX 32
+
+static const uint16_t entity_disp[NANO_ENTITY_BUCKETS] = {
+	7, 29, 15, 0, 0, 21, 1, 31, 0, 47, 5, 19,
+	5, 2, 3, 7, 5, 37, 58, 2, 21, 181, 10, 22,
+	8, 3, 117, 5, 3, 3, 28, 6, 2, 76, 3, 1,
+	85, 19, 1, 3, 23, 9, 16, 121, 26, 1, 3, 52,
+	9, 1, 33, 43, 10, 30, 72, 3, 14, 32, 5, 1,
+	2, 1, 23, 13, 40, 6, 18, 18, 108, 46, 3, 10,
+	3, 1, 13, 6, 8, 31, 7, 1, 10, 4, 69, 2,
+	27, 4, 32, 0, 6, 1, 2, 10, 3, 15, 2, 38,
+	13, 43, 2, 1, 1, 33, 24, 2, 4, 13, 25, 4,
+	19, 3, 0, 6, 25, 9, 7, 19, 5, 5, 122, 88,
+	19, 14, 4, 88, 2, 34, 58, 17, 0, 100, 9, 4,
+	55, 216, 15, 15, 9, 2, 8, 67, 5, 15, 23, 1,
+	6, 10, 22, 54, 7, 46, 9, 50, 17, 25, 0, 39,
+	3, 10, 4, 0, 6, 0, 45, 9, 6, 1, 4, 1,
+	0, 2, 1, 2, 5, 7, 2, 40, 5, 6, 14, 4,
+	3, 1, 7, 9, 11, 81, 77, 3, 21, 20, 1, 4,
+	2, 1, 1, 1, 74, 5, 170, 14, 23, 2, 80, 39,
+	183, 69, 9, 2, 63, 2, 7, 2, 1, 7, 27, 79,
+	13, 4, 85, 41, 65, 7, 113, 12, 1, 26, 2, 13,
+	4, 17, 97, 7, 56, 5, 9, 1, 7, 1, 14, 30,
+	0, 3, 2, 3, 78, 17, 49, 64, 44, 1, 50, 38,
+	13, 25, 109, 2, 24, 0, 46, 126, 11, 3, 1, 39,
+	21, 8, 50, 94, 4, 28, 2, 3, 1, 15, 82, 88,
+	66, 22, 3, 2, 61, 2, 3, 10, 5, 87, 7, 121,
+	47, 75, 7, 30, 47, 7, 134, 2, 57, 36, 16, 28,
+	37, 1, 67, 47, 1, 1, 6, 9, 23, 0, 108, 1,
+	3, 79, 12, 30, 6, 3, 72, 23, 3, 22, 85, 207,
+	6, 20, 53, 5, 37, 15, 2, 4, 76, 16, 11, 9,
+	11, 82, 0, 25, 18, 58, 59, 11, 3, 10, 6, 71,
+	23, 1, 4, 22, 44, 41, 6, 34, 42, 46, 1, 87,
+	17, 31, 1, 47, 1, 10, 19, 14, 4, 4, 21, 44,
+	74, 1, 36, 43, 1, 128, 1, 120, 35, 32, 3, 13,
+	0, 203, 16, 9, 20, 51, 0, 44, 6, 19, 23, 14,
+	121, 71, 8, 34, 143, 0, 114, 7, 2, 145, 22, 3,
+	26, 107, 201, 15, 7, 11, 31, 0, 1, 102, 167, 2,
+	40, 11, 20, 57, 18, 6, 2, 14, 25, 2, 79, 3,
+	3, 3, 0, 67, 16, 24, 0, 7, 84, 1, 3, 44,
+	35, 6, 66, 2, 50, 3, 39, 7, 2, 24, 3, 80,
+	14, 12, 4, 17, 98, 207, 28, 1, 77, 1, 5, 70,
+	108, 64, 27, 1, 6, 77, 149, 1, 25, 95, 5, 3,
+	64, 2, 16, 75, 72, 13, 428, 49, 23, 1, 1, 7,
+	102, 21, 67, 6, 8, 93, 0, 20, 54, 57, 20, 54,
+	5, 31, 17, 19, 62, 4, 24, 239, 165, 92, 7, 6,
+	218, 30, 2, 301, 174, 115, 20, 25, 1, 87, 12, 27,
+	94, 133, 16, 12, 58, 23, 65, 32, 15, 15, 3, 31,
+	1, 59, 0, 39, 34, 1, 91, 78, 94, 3, 17, 9,
+	48, 0, 15, 162, 156, 3, 43, 8, 67, 157, 14, 60,
+	109, 60, 54, 83, 158, 284, 131, 1, 4, 50, 3, 127,
+	39, 70, 138, 4, 271, 134, 50, 169, 41, 8, 38, 45,
+	13, 479, 112, 123, 55, 63, 47, 181, 137, 18, 263, 316,
+	167, 255, 64, 45, 77, 80, 12, 174, 217, 325, 8, 74,
+	287, 18, 246, 0, 0, 19, 8, 204, 16, 14, 203, 56,
+	312, 0, 1, 5, 4, 4, 248, 0, 20, 132, 222, 1,
+	49, 4, 52, 29, 60, 0, 404, 109, 41, 13, 68, 79,
+	6, 28, 22, 30, 208, 64, 1, 360, 11, 1, 4, 2,
+	0, 112, 35, 208, 11, 120, 233, 107, 1, 7, 426, 134,
+	51, 67, 387, 8, 157, 147, 73, 105, 1, 1, 4, 1,
+	255, 405, 3, 1, 71, 303, 160, 296, 545, 707, 232, 22,
+	1, 95, 64, 346, 128, 403, 184, 45, 61, 10, 548, 8,
+	117, 184, 202, 191, 0, 16, 55, 367, 246, 320, 1, 99,
+	47, 251, 4, 214, 4, 1, 13, 348, 189, 7, 0, 1,
+	228, 77, 101, 1, 218, 57, 93, 175, 451, 14, 46,
+};
+
+// 名前(;が付かないものは古い書き方で許されているもの)と値のUTF-8
+static const struct entity {
+	const char *name;
+	const char *value;
+} entities[NANO_ENTITY_COUNT] = {
+	{ "varsupsetneqq;", "\342\253\214\357\270\200" },
+	{ "bigoplus;", "\342\250\201" },
+	{ "angmsdah;", "\342\246\257" },
+	{ "egrave;", "\303\250" },
+	{ "cire;", "\342\211\227" },
+	{ "tdot;", "\342\203\233" },
+	{ "NotGreaterTilde;", "\342\211\265" },
+	{ "male;", "\342\231\202" },
+	{ "nwArr;", "\342\207\226" },
+	{ "ll;", "\342\211\252" },
+	{ "AElig;", "\303\206" },
+	{ "ovbar;", "\342\214\275" },
+	{ "period;", "." },
+	{ "infin;", "\342\210\236" },
+	{ "bnequiv;", "\342\211\241\342\203\245" },
+	{ "Mopf;", "\360\235\225\204" },
+	{ "lmoustache;", "\342\216\260" },
+	{ "succneqq;", "\342\252\266" },
+	{ "triminus;", "\342\250\272" },
+	{ "nexist;", "\342\210\204" },
+	{ "risingdotseq;", "\342\211\223" },
+	{ "Bumpeq;", "\342\211\216" },
+	{ "bsim;", "\342\210\275" },
+	{ "intlarhk;", "\342\250\227" },
+	{ "SuchThat;", "\342\210\213" },
+	{ "pi;", "\317\200" },
+	{ "Sscr;", "\360\235\222\256" },
+	{ "nVDash;", "\342\212\257" },
+	{ "subplus;", "\342\252\277" },
+	{ "Aring", "\303\205" },
+	{ "rmoust;", "\342\216\261" },
+	{ "lozenge;", "\342\227\212" },
+	{ "Lt;", "\342\211\252" },
+	{ "rceil;", "\342\214\211" },
+	{ "CircleDot;", "\342\212\231" },
+	{ "subdot;", "\342\252\275" },
+	{ "nrarrc;", "\342\244\263\314\270" },
+	{ "subseteq;", "\342\212\206" },
+	{ "zigrarr;", "\342\207\235" },
+	{ "Gcirc;", "\304\234" },
+	{ "diamond;", "\342\213\204" },
+	{ "eta;", "\316\267" },
+	{ "Fcy;", "\320\244" },
+	{ "NotGreater;", "\342\211\257" },
+	{ "because;", "\342\210\265" },
+	{ "drcorn;", "\342\214\237" },
+	{ "gescc;", "\342\252\251" },
+	{ "subedot;", "\342\253\203" },
+	{ "boxUL;", "\342\225\235" },
+	{ "LeftRightVector;", "\342\245\216" },
+	{ "smallsetminus;", "\342\210\226" },
+	{ "ocirc", "\303\264" },
+	{ "para", "\302\266" },
+	{ "cscr;", "\360\235\222\270" },
+	{ "wedbar;", "\342\251\237" },
+	{ "DoubleLeftTee;", "\342\253\244" },
+	{ "prime;", "\342\200\262" },
+	{ "num;", "#" },
+	{ "Umacr;", "\305\252" },
+	{ "dash;", "\342\200\220" },
+	{ "prcue;", "\342\211\274" },
+	{ "Eta;", "\316\227" },
+	{ "scirc;", "\305\235" },
+	{ "Longleftarrow;", "\342\237\270" },
+	{ "EmptySmallSquare;", "\342\227\273" },
+	{ "Cross;", "\342\250\257" },
+	{ "harrw;", "\342\206\255" },
+	{ "Ocirc", "\303\224" },
+	{ "uacute;", "\303\272" },
+	{ "barwedge;", "\342\214\205" },
+	{ "glj;", "\342\252\244" },
+	{ "forall;", "\342\210\200" },
+	{ "rbrace;", "}" },
+	{ "boxuL;", "\342\225\233" },
+	{ "RoundImplies;", "\342\245\260" },
+	{ "Cedilla;", "\302\270" },
+	{ "Oacute;", "\303\223" },
+	{ "DownBreve;", "\314\221" },
+	{ "ccaron;", "\304\215" },
+	{ "coprod;", "\342\210\220" },
+	{ "NotExists;", "\342\210\204" },
+	{ "Vee;", "\342\213\201" },
+	{ "half;", "\302\275" },
+	{ "Cscr;", "\360\235\222\236" },
+	{ "mfr;", "\360\235\224\252" },
+	{ "boxHU;", "\342\225\251" },
+	{ "ntgl;", "\342\211\271" },
+	{ "hyphen;", "\342\200\220" },
+	{ "caret;", "\342\201\201" },
+	{ "AMP", "&" },
+	{ "NegativeVeryThinSpace;", "\342\200\213" },
+	{ "square;", "\342\226\241" },
+	{ "simplus;", "\342\250\244" },
+	{ "blk12;", "\342\226\222" },
+	{ "Gammad;", "\317\234" },
+	{ "Yuml;", "\305\270" },
+	{ "OverBar;", "\342\200\276" },
+	{ "caps;", "\342\210\251\357\270\200" },
+	{ "oint;", "\342\210\256" },
+	{ "frac56;", "\342\205\232" },
+	{ "Precedes;", "\342\211\272" },
+	{ "tstrok;", "\305\247" },
+	{ "RuleDelayed;", "\342\247\264" },
+	{ "otimes;", "\342\212\227" },
+	{ "Bcy;", "\320\221" },
+	{ "larr;", "\342\206\220" },
+	{ "Coproduct;", "\342\210\220" },
+	{ "Jfr;", "\360\235\224\215" },
+	{ "igrave", "\303\254" },
+	{ "lbrke;", "\342\246\213" },
+	{ "omega;", "\317\211" },
+	{ "NotEqualTilde;", "\342\211\202\314\270" },
+	{ "xcup;", "\342\213\203" },
+	{ "par;", "\342\210\245" },
+	{ "ETH", "\303\220" },
+	{ "yucy;", "\321\216" },
+	{ "capand;", "\342\251\204" },
+	{ "psi;", "\317\210" },
+	{ "Uuml;", "\303\234" },
+	{ "supsetneq;", "\342\212\213" },
+	{ "PlusMinus;", "\302\261" },
+	{ "NotGreaterSlantEqual;", "\342\251\276\314\270" },
+	{ "weierp;", "\342\204\230" },
+	{ "cuepr;", "\342\213\236" },
+	{ "Nopf;", "\342\204\225" },
+	{ "kcedil;", "\304\267" },
+	{ "LowerRightArrow;", "\342\206\230" },
+	{ "hstrok;", "\304\247" },
+	{ "brvbar;", "\302\246" },
+	{ "RightTriangleBar;", "\342\247\220" },
+	{ "lobrk;", "\342\237\246" },
+	{ "Lang;", "\342\237\252" },
+	{ "Jcirc;", "\304\264" },
+	{ "iinfin;", "\342\247\234" },
+	{ "dscy;", "\321\225" },
+	{ "dblac;", "\313\235" },
+	{ "emptyv;", "\342\210\205" },
+	{ "Ubrcy;", "\320\216" },
+	{ "uuml", "\303\274" },
+	{ "Hscr;", "\342\204\213" },
+	{ "shy;", "\302\255" },
+	{ "pluse;", "\342\251\262" },
+	{ "supmult;", "\342\253\202" },
+	{ "Egrave", "\303\210" },
+	{ "npart;", "\342\210\202\314\270" },
+	{ "odot;", "\342\212\231" },
+	{ "upsilon;", "\317\205" },
+	{ "epar;", "\342\213\225" },
+	{ "frown;", "\342\214\242" },
+	{ "Qfr;", "\360\235\224\224" },
+	{ "ape;", "\342\211\212" },
+	{ "ocir;", "\342\212\232" },
+	{ "vert;", "|" },
+	{ "lsh;", "\342\206\260" },
+	{ "sqsubseteq;", "\342\212\221" },
+	{ "nharr;", "\342\206\256" },
+	{ "bne;", "=\342\203\245" },
+	{ "isin;", "\342\210\210" },
+	{ "prec;", "\342\211\272" },
+	{ "rharu;", "\342\207\200" },
+	{ "larrtl;", "\342\206\242" },
+	{ "radic;", "\342\210\232" },
+	{ "iquest", "\302\277" },
+	{ "clubsuit;", "\342\231\243" },
+	{ "alefsym;", "\342\204\265" },
+	{ "searr;", "\342\206\230" },
+	{ "conint;", "\342\210\256" },
+	{ "boxtimes;", "\342\212\240" },
+	{ "jcirc;", "\304\265" },
+	{ "hamilt;", "\342\204\213" },
+	{ "ncup;", "\342\251\202" },
+	{ "Cfr;", "\342\204\255" },
+	{ "iexcl", "\302\241" },
+	{ "gesdotol;", "\342\252\204" },
+	{ "xvee;", "\342\213\201" },
+	{ "Vbar;", "\342\253\253" },
+	{ "nrArr;", "\342\207\217" },
+	{ "erarr;", "\342\245\261" },
+	{ "LT", "<" },
+	{ "nsimeq;", "\342\211\204" },
+	{ "Longrightarrow;", "\342\237\271" },
+	{ "RightVector;", "\342\207\200" },
+	{ "varpropto;", "\342\210\235" },
+	{ "setminus;", "\342\210\226" },
+	{ "LongLeftArrow;", "\342\237\265" },
+	{ "bdquo;", "\342\200\236" },
+	{ "nprec;", "\342\212\200" },
+	{ "ffr;", "\360\235\224\243" },
+	{ "LeftArrowRightArrow;", "\342\207\206" },
+	{ "DiacriticalTilde;", "\313\234" },
+	{ "ccedil", "\303\247" },
+	{ "curvearrowright;", "\342\206\267" },
+	{ "napE;", "\342\251\260\314\270" },
+	{ "approx;", "\342\211\210" },
+	{ "Tscr;", "\360\235\222\257" },
+	{ "nrightarrow;", "\342\206\233" },
+	{ "lvnE;", "\342\211\250\357\270\200" },
+	{ "ifr;", "\360\235\224\246" },
+	{ "DownRightVectorBar;", "\342\245\227" },
+	{ "thinsp;", "\342\200\211" },
+	{ "phi;", "\317\206" },
+	{ "DoubleVerticalBar;", "\342\210\245" },
+	{ "NotNestedLessLess;", "\342\252\241\314\270" },
+	{ "Diamond;", "\342\213\204" },
+	{ "udblac;", "\305\261" },
+	{ "pluscir;", "\342\250\242" },
+	{ "Rcaron;", "\305\230" },
+	{ "NotGreaterEqual;", "\342\211\261" },
+	{ "lrcorner;", "\342\214\237" },
+	{ "rnmid;", "\342\253\256" },
+	{ "epsi;", "\316\265" },
+	{ "emsp14;", "\342\200\205" },
+	{ "blacktriangledown;", "\342\226\276" },
+	{ "simne;", "\342\211\206" },
+	{ "TSHcy;", "\320\213" },
+	{ "frac12", "\302\275" },
+	{ "sce;", "\342\252\260" },
+	{ "upuparrows;", "\342\207\210" },
+	{ "Sacute;", "\305\232" },
+	{ "Zdot;", "\305\273" },
+	{ "thickapprox;", "\342\211\210" },
+	{ "imacr;", "\304\253" },
+	{ "LeftTee;", "\342\212\243" },
+	{ "triangleright;", "\342\226\271" },
+	{ "ucirc", "\303\273" },
+	{ "andslope;", "\342\251\230" },
+	{ "boxDr;", "\342\225\223" },
+	{ "spar;", "\342\210\245" },
+	{ "xharr;", "\342\237\267" },
+	{ "Zeta;", "\316\226" },
+	{ "excl;", "!" },
+	{ "mcomma;", "\342\250\251" },
+	{ "vnsup;", "\342\212\203\342\203\222" },
+	{ "rHar;", "\342\245\244" },
+	{ "LeftAngleBracket;", "\342\237\250" },
+	{ "tfr;", "\360\235\224\261" },
+	{ "LeftRightArrow;", "\342\206\224" },
+	{ "Zacute;", "\305\271" },
+	{ "prap;", "\342\252\267" },
+	{ "REG", "\302\256" },
+	{ "Dcaron;", "\304\216" },
+	{ "LeftFloor;", "\342\214\212" },
+	{ "Uscr;", "\360\235\222\260" },
+	{ "triangledown;", "\342\226\277" },
+	{ "NewLine;", "\012" },
+	{ "ycy;", "\321\213" },
+	{ "ngtr;", "\342\211\257" },
+	{ "dArr;", "\342\207\223" },
+	{ "Emacr;", "\304\222" },
+	{ "quaternions;", "\342\204\215" },
+	{ "eacute;", "\303\251" },
+	{ "acd;", "\342\210\277" },
+	{ "lltri;", "\342\227\272" },
+	{ "ENG;", "\305\212" },
+	{ "supsim;", "\342\253\210" },
+	{ "nsupseteq;", "\342\212\211" },
+	{ "bump;", "\342\211\216" },
+	{ "icirc;", "\303\256" },
+	{ "Rfr;", "\342\204\234" },
+	{ "nges;", "\342\251\276\314\270" },
+	{ "frac14;", "\302\274" },
+	{ "yen", "\302\245" },
+	{ "bsime;", "\342\213\215" },
+	{ "zwnj;", "\342\200\214" },
+	{ "Square;", "\342\226\241" },
+	{ "bopf;", "\360\235\225\223" },
+	{ "Oopf;", "\360\235\225\206" },
+	{ "backcong;", "\342\211\214" },
+	{ "otimesas;", "\342\250\266" },
+	{ "gvertneqq;", "\342\211\251\357\270\200" },
+	{ "operp;", "\342\246\271" },
+	{ "bigstar;", "\342\230\205" },
+	{ "midcir;", "\342\253\260" },
+	{ "DownLeftVectorBar;", "\342\245\226" },
+	{ "expectation;", "\342\204\260" },
+	{ "LeftUpVector;", "\342\206\277" },
+	{ "notinE;", "\342\213\271\314\270" },
+	{ "NestedLessLess;", "\342\211\252" },
+	{ "Ouml", "\303\226" },
+	{ "oacute;", "\303\263" },
+	{ "blacktriangleright;", "\342\226\270" },
+	{ "RightAngleBracket;", "\342\237\251" },
+	{ "simrarr;", "\342\245\262" },
+	{ "Qopf;", "\342\204\232" },
+	{ "equest;", "\342\211\237" },
+	{ "apos;", "'" },
+	{ "perp;", "\342\212\245" },
+	{ "nLt;", "\342\211\252\342\203\222" },
+	{ "precneqq;", "\342\252\265" },
+	{ "cacute;", "\304\207" },
+	{ "lesg;", "\342\213\232\357\270\200" },
+	{ "Congruent;", "\342\211\241" },
+	{ "middot;", "\302\267" },
+	{ "gacute;", "\307\265" },
+	{ "gsiml;", "\342\252\220" },
+	{ "notinvc;", "\342\213\266" },
+	{ "dtrif;", "\342\226\276" },
+	{ "nsqsube;", "\342\213\242" },
+	{ "notindot;", "\342\213\265\314\270" },
+	{ "lbrack;", "[" },
+	{ "Hcirc;", "\304\244" },
+	{ "ni;", "\342\210\213" },
+	{ "macr", "\302\257" },
+	{ "njcy;", "\321\232" },
+	{ "div;", "\303\267" },
+	{ "boxDL;", "\342\225\227" },
+	{ "ratail;", "\342\244\232" },
+	{ "siml;", "\342\252\235" },
+	{ "simgE;", "\342\252\240" },
+	{ "zscr;", "\360\235\223\217" },
+	{ "rsquo;", "\342\200\231" },
+	{ "scap;", "\342\252\270" },
+	{ "Iota;", "\316\231" },
+	{ "TildeEqual;", "\342\211\203" },
+	{ "asymp;", "\342\211\210" },
+	{ "range;", "\342\246\245" },
+	{ "nabla;", "\342\210\207" },
+	{ "lsquor;", "\342\200\232" },
+	{ "timesd;", "\342\250\260" },
+	{ "iuml;", "\303\257" },
+	{ "DoubleRightTee;", "\342\212\250" },
+	{ "swarhk;", "\342\244\246" },
+	{ "Colon;", "\342\210\267" },
+	{ "Gfr;", "\360\235\224\212" },
+	{ "mldr;", "\342\200\246" },
+	{ "UpDownArrow;", "\342\206\225" },
+	{ "yicy;", "\321\227" },
+	{ "lharu;", "\342\206\274" },
+	{ "cedil;", "\302\270" },
+	{ "auml;", "\303\244" },
+	{ "nGt;", "\342\211\253\342\203\222" },
+	{ "ljcy;", "\321\231" },
+	{ "Aacute;", "\303\201" },
+	{ "starf;", "\342\230\205" },
+	{ "Kscr;", "\360\235\222\246" },
+	{ "iiint;", "\342\210\255" },
+	{ "Jsercy;", "\320\210" },
+	{ "nle;", "\342\211\260" },
+	{ "rightleftharpoons;", "\342\207\214" },
+	{ "SupersetEqual;", "\342\212\207" },
+	{ "rfloor;", "\342\214\213" },
+	{ "subE;", "\342\253\205" },
+	{ "vBar;", "\342\253\250" },
+	{ "Lambda;", "\316\233" },
+	{ "lbrace;", "{" },
+	{ "Oslash", "\303\230" },
+	{ "rlm;", "\342\200\217" },
+	{ "int;", "\342\210\253" },
+	{ "searrow;", "\342\206\230" },
+	{ "Yopf;", "\360\235\225\220" },
+	{ "MediumSpace;", "\342\201\237" },
+	{ "nvgt;", ">\342\203\222" },
+	{ "map;", "\342\206\246" },
+	{ "pound;", "\302\243" },
+	{ "Imacr;", "\304\252" },
+	{ "Scedil;", "\305\236" },
+	{ "lneq;", "\342\252\207" },
+	{ "pound", "\302\243" },
+	{ "mcy;", "\320\274" },
+	{ "vcy;", "\320\262" },
+	{ "hearts;", "\342\231\245" },
+	{ "DoubleLongRightArrow;", "\342\237\271" },
+	{ "prnap;", "\342\252\271" },
+	{ "DoubleContourIntegral;", "\342\210\257" },
+	{ "rdldhar;", "\342\245\251" },
+	{ "Ubreve;", "\305\254" },
+	{ "emacr;", "\304\223" },
+	{ "leftrightarrow;", "\342\206\224" },
+	{ "Ycy;", "\320\253" },
+	{ "it;", "\342\201\242" },
+	{ "GJcy;", "\320\203" },
+	{ "Sfr;", "\360\235\224\226" },
+	{ "nltrie;", "\342\213\254" },
+	{ "pm;", "\302\261" },
+	{ "Cup;", "\342\213\223" },
+	{ "TildeFullEqual;", "\342\211\205" },
+	{ "gel;", "\342\213\233" },
+	{ "Cacute;", "\304\206" },
+	{ "mapsto;", "\342\206\246" },
+	{ "lates;", "\342\252\255\357\270\200" },
+	{ "Dopf;", "\360\235\224\273" },
+	{ "larrsim;", "\342\245\263" },
+	{ "rarr;", "\342\206\222" },
+	{ "dharl;", "\342\207\203" },
+	{ "Abreve;", "\304\202" },
+	{ "Topf;", "\360\235\225\213" },
+	{ "barvee;", "\342\212\275" },
+	{ "cupor;", "\342\251\205" },
+	{ "mid;", "\342\210\243" },
+	{ "sbquo;", "\342\200\232" },
+	{ "Iscr;", "\342\204\220" },
+	{ "npolint;", "\342\250\224" },
+	{ "lesseqgtr;", "\342\213\232" },
+	{ "bumpeq;", "\342\211\217" },
+	{ "realpart;", "\342\204\234" },
+	{ "rtrie;", "\342\212\265" },
+	{ "sqcups;", "\342\212\224\357\270\200" },
+	{ "rbrksld;", "\342\246\216" },
+	{ "ltquest;", "\342\251\273" },
+	{ "tilde;", "\313\234" },
+	{ "Fouriertrf;", "\342\204\261" },
+	{ "ntlg;", "\342\211\270" },
+	{ "triangleq;", "\342\211\234" },
+	{ "ncongdot;", "\342\251\255\314\270" },
+	{ "Kcedil;", "\304\266" },
+	{ "jukcy;", "\321\224" },
+	{ "isindot;", "\342\213\265" },
+	{ "real;", "\342\204\234" },
+	{ "boxV;", "\342\225\221" },
+	{ "boxDR;", "\342\225\224" },
+	{ "uogon;", "\305\263" },
+	{ "mapstodown;", "\342\206\247" },
+	{ "LeftCeiling;", "\342\214\210" },
+	{ "nsc;", "\342\212\201" },
+	{ "blk34;", "\342\226\223" },
+	{ "marker;", "\342\226\256" },
+	{ "mstpos;", "\342\210\276" },
+	{ "zacute;", "\305\272" },
+	{ "NotVerticalBar;", "\342\210\244" },
+	{ "Wedge;", "\342\213\200" },
+	{ "Tau;", "\316\244" },
+	{ "ShortRightArrow;", "\342\206\222" },
+	{ "swnwar;", "\342\244\252" },
+	{ "beta;", "\316\262" },
+	{ "eg;", "\342\252\232" },
+	{ "DownRightVector;", "\342\207\201" },
+	{ "smte;", "\342\252\254" },
+	{ "sfrown;", "\342\214\242" },
+	{ "sol;", "/" },
+	{ "ntilde", "\303\261" },
+	{ "NotTildeFullEqual;", "\342\211\207" },
+	{ "rAarr;", "\342\207\233" },
+	{ "nisd;", "\342\213\272" },
+	{ "ufisht;", "\342\245\276" },
+	{ "yopf;", "\360\235\225\252" },
+	{ "sqsup;", "\342\212\220" },
+	{ "twoheadleftarrow;", "\342\206\236" },
+	{ "sqsupe;", "\342\212\222" },
+	{ "smile;", "\342\214\243" },
+	{ "Pfr;", "\360\235\224\223" },
+	{ "setmn;", "\342\210\226" },
+	{ "fnof;", "\306\222" },
+	{ "circeq;", "\342\211\227" },
+	{ "lparlt;", "\342\246\223" },
+	{ "ltlarr;", "\342\245\266" },
+	{ "DownTeeArrow;", "\342\206\247" },
+	{ "precapprox;", "\342\252\267" },
+	{ "abreve;", "\304\203" },
+	{ "subne;", "\342\212\212" },
+	{ "notnivb;", "\342\213\276" },
+	{ "vee;", "\342\210\250" },
+	{ "puncsp;", "\342\200\210" },
+	{ "Union;", "\342\213\203" },
+	{ "lscr;", "\360\235\223\201" },
+	{ "ffllig;", "\357\254\204" },
+	{ "angmsdag;", "\342\246\256" },
+	{ "angmsdaa;", "\342\246\250" },
+	{ "frasl;", "\342\201\204" },
+	{ "DownLeftTeeVector;", "\342\245\236" },
+	{ "midast;", "*" },
+	{ "Vcy;", "\320\222" },
+	{ "Not;", "\342\253\254" },
+	{ "LeftTeeArrow;", "\342\206\244" },
+	{ "DoubleDownArrow;", "\342\207\223" },
+	{ "Iacute;", "\303\215" },
+	{ "cent", "\302\242" },
+	{ "nspar;", "\342\210\246" },
+	{ "OverParenthesis;", "\342\217\234" },
+	{ "rbbrk;", "\342\235\263" },
+	{ "dopf;", "\360\235\225\225" },
+	{ "NonBreakingSpace;", "\302\240" },
+	{ "cdot;", "\304\213" },
+	{ "looparrowright;", "\342\206\254" },
+	{ "curlyeqsucc;", "\342\213\237" },
+	{ "boxdl;", "\342\224\220" },
+	{ "xmap;", "\342\237\274" },
+	{ "becaus;", "\342\210\265" },
+	{ "cup;", "\342\210\252" },
+	{ "nvge;", "\342\211\245\342\203\222" },
+	{ "intprod;", "\342\250\274" },
+	{ "fltns;", "\342\226\261" },
+	{ "frac25;", "\342\205\226" },
+	{ "circ;", "\313\206" },
+	{ "Kfr;", "\360\235\224\216" },
+	{ "iopf;", "\360\235\225\232" },
+	{ "ffilig;", "\357\254\203" },
+	{ "Eopf;", "\360\235\224\274" },
+	{ "Hfr;", "\342\204\214" },
+	{ "zopf;", "\360\235\225\253" },
+	{ "NotLessTilde;", "\342\211\264" },
+	{ "oast;", "\342\212\233" },
+	{ "die;", "\302\250" },
+	{ "DotDot;", "\342\203\234" },
+	{ "Omega;", "\316\251" },
+	{ "dlcrop;", "\342\214\215" },
+	{ "nvinfin;", "\342\247\236" },
+	{ "roang;", "\342\237\255" },
+	{ "trpezium;", "\342\217\242" },
+	{ "Dot;", "\302\250" },
+	{ "circlearrowleft;", "\342\206\272" },
+	{ "twoheadrightarrow;", "\342\206\240" },
+	{ "PrecedesEqual;", "\342\252\257" },
+	{ "nvlt;", "<\342\203\222" },
+	{ "ugrave", "\303\271" },
+	{ "lfloor;", "\342\214\212" },
+	{ "lbbrk;", "\342\235\262" },
+	{ "omacr;", "\305\215" },
+	{ "Sub;", "\342\213\220" },
+	{ "acE;", "\342\210\276\314\263" },
+	{ "ltimes;", "\342\213\211" },
+	{ "ic;", "\342\201\243" },
+	{ "UpperRightArrow;", "\342\206\227" },
+	{ "lotimes;", "\342\250\264" },
+	{ "langd;", "\342\246\221" },
+	{ "Cconint;", "\342\210\260" },
+	{ "leftleftarrows;", "\342\207\207" },
+	{ "Sum;", "\342\210\221" },
+	{ "Aring;", "\303\205" },
+	{ "iocy;", "\321\221" },
+	{ "nesim;", "\342\211\202\314\270" },
+	{ "empty;", "\342\210\205" },
+	{ "darr;", "\342\206\223" },
+	{ "Lcaron;", "\304\275" },
+	{ "plusdo;", "\342\210\224" },
+	{ "swarr;", "\342\206\231" },
+	{ "toea;", "\342\244\250" },
+	{ "ApplyFunction;", "\342\201\241" },
+	{ "imof;", "\342\212\267" },
+	{ "LeftTriangleEqual;", "\342\212\264" },
+	{ "SHCHcy;", "\320\251" },
+	{ "rhard;", "\342\207\201" },
+	{ "lnap;", "\342\252\211" },
+	{ "imped;", "\306\265" },
+	{ "dollar;", "$" },
+	{ "jopf;", "\360\235\225\233" },
+	{ "tbrk;", "\342\216\264" },
+	{ "rarrlp;", "\342\206\254" },
+	{ "llarr;", "\342\207\207" },
+	{ "hscr;", "\360\235\222\275" },
+	{ "notnivc;", "\342\213\275" },
+	{ "Subset;", "\342\213\220" },
+	{ "gtreqless;", "\342\213\233" },
+	{ "gtrarr;", "\342\245\270" },
+	{ "harr;", "\342\206\224" },
+	{ "xfr;", "\360\235\224\265" },
+	{ "xcirc;", "\342\227\257" },
+	{ "lneqq;", "\342\211\250" },
+	{ "UpTeeArrow;", "\342\206\245" },
+	{ "Dscr;", "\360\235\222\237" },
+	{ "copy;", "\302\251" },
+	{ "ggg;", "\342\213\231" },
+	{ "jcy;", "\320\271" },
+	{ "scsim;", "\342\211\277" },
+	{ "Uarr;", "\342\206\237" },
+	{ "plus;", "+" },
+	{ "Eogon;", "\304\230" },
+	{ "rAtail;", "\342\244\234" },
+	{ "veeeq;", "\342\211\232" },
+	{ "Uuml", "\303\234" },
+	{ "Gg;", "\342\213\231" },
+	{ "nsubseteqq;", "\342\253\205\314\270" },
+	{ "MinusPlus;", "\342\210\223" },
+	{ "intcal;", "\342\212\272" },
+	{ "boxVR;", "\342\225\240" },
+	{ "aelig", "\303\246" },
+	{ "uharl;", "\342\206\277" },
+	{ "vBarv;", "\342\253\251" },
+	{ "cent;", "\302\242" },
+	{ "filig;", "\357\254\201" },
+	{ "lesdoto;", "\342\252\201" },
+	{ "ruluhar;", "\342\245\250" },
+	{ "Kcy;", "\320\232" },
+	{ "Vert;", "\342\200\226" },
+	{ "larrlp;", "\342\206\253" },
+	{ "ccirc;", "\304\211" },
+	{ "nsccue;", "\342\213\241" },
+	{ "aring;", "\303\245" },
+	{ "umacr;", "\305\253" },
+	{ "ClockwiseContourIntegral;", "\342\210\262" },
+	{ "rarrap;", "\342\245\265" },
+	{ "otilde", "\303\265" },
+	{ "Updownarrow;", "\342\207\225" },
+	{ "gg;", "\342\211\253" },
+	{ "ltri;", "\342\227\203" },
+	{ "nvHarr;", "\342\244\204" },
+	{ "ReverseElement;", "\342\210\213" },
+	{ "Yacute", "\303\235" },
+	{ "nleftrightarrow;", "\342\206\256" },
+	{ "prsim;", "\342\211\276" },
+	{ "bemptyv;", "\342\246\260" },
+	{ "Ugrave", "\303\231" },
+	{ "supedot;", "\342\253\204" },
+	{ "compfn;", "\342\210\230" },
+	{ "gesdot;", "\342\252\200" },
+	{ "LessGreater;", "\342\211\266" },
+	{ "uscr;", "\360\235\223\212" },
+	{ "lrm;", "\342\200\216" },
+	{ "vartriangleleft;", "\342\212\262" },
+	{ "fllig;", "\357\254\202" },
+	{ "curarr;", "\342\206\267" },
+	{ "DoubleDot;", "\302\250" },
+	{ "lsquo;", "\342\200\230" },
+	{ "omid;", "\342\246\266" },
+	{ "Uacute", "\303\232" },
+	{ "Dfr;", "\360\235\224\207" },
+	{ "aleph;", "\342\204\265" },
+	{ "hybull;", "\342\201\203" },
+	{ "NotSquareSubsetEqual;", "\342\213\242" },
+	{ "nsmid;", "\342\210\244" },
+	{ "cuwed;", "\342\213\217" },
+	{ "LeftUpVectorBar;", "\342\245\230" },
+	{ "Backslash;", "\342\210\226" },
+	{ "ijlig;", "\304\263" },
+	{ "Zscr;", "\360\235\222\265" },
+	{ "zcaron;", "\305\276" },
+	{ "qprime;", "\342\201\227" },
+	{ "erDot;", "\342\211\223" },
+	{ "gbreve;", "\304\237" },
+	{ "nprcue;", "\342\213\240" },
+	{ "female;", "\342\231\200" },
+	{ "crarr;", "\342\206\265" },
+	{ "ThickSpace;", "\342\201\237\342\200\212" },
+	{ "lowbar;", "_" },
+	{ "CapitalDifferentialD;", "\342\205\205" },
+	{ "boxHd;", "\342\225\244" },
+	{ "xlArr;", "\342\237\270" },
+	{ "sqsupset;", "\342\212\220" },
+	{ "easter;", "\342\251\256" },
+	{ "ucirc;", "\303\273" },
+	{ "epsilon;", "\316\265" },
+	{ "nsupE;", "\342\253\206\314\270" },
+	{ "scedil;", "\305\237" },
+	{ "UpArrow;", "\342\206\221" },
+	{ "lbarr;", "\342\244\214" },
+	{ "succnapprox;", "\342\252\272" },
+	{ "LongLeftRightArrow;", "\342\237\267" },
+	{ "ulcorner;", "\342\214\234" },
+	{ "Eacute;", "\303\211" },
+	{ "kjcy;", "\321\234" },
+	{ "amalg;", "\342\250\277" },
+	{ "varsubsetneq;", "\342\212\212\357\270\200" },
+	{ "Gcy;", "\320\223" },
+	{ "pfr;", "\360\235\224\255" },
+	{ "target;", "\342\214\226" },
+	{ "lescc;", "\342\252\250" },
+	{ "asympeq;", "\342\211\215" },
+	{ "frac35;", "\342\205\227" },
+	{ "Assign;", "\342\211\224" },
+	{ "boxVl;", "\342\225\242" },
+	{ "ldsh;", "\342\206\262" },
+	{ "dcy;", "\320\264" },
+	{ "DownLeftRightVector;", "\342\245\220" },
+	{ "shcy;", "\321\210" },
+	{ "Cayleys;", "\342\204\255" },
+	{ "uharr;", "\342\206\276" },
+	{ "bsolhsub;", "\342\237\210" },
+	{ "InvisibleTimes;", "\342\201\242" },
+	{ "verbar;", "|" },
+	{ "Auml", "\303\204" },
+	{ "varepsilon;", "\317\265" },
+	{ "Scaron;", "\305\240" },
+	{ "Delta;", "\316\224" },
+	{ "rightarrow;", "\342\206\222" },
+	{ "models;", "\342\212\247" },
+	{ "supsub;", "\342\253\224" },
+	{ "awint;", "\342\250\221" },
+	{ "ord;", "\342\251\235" },
+	{ "Proportional;", "\342\210\235" },
+	{ "Pr;", "\342\252\273" },
+	{ "fflig;", "\357\254\200" },
+	{ "HumpDownHump;", "\342\211\216" },
+	{ "boxplus;", "\342\212\236" },
+	{ "percnt;", "%" },
+	{ "late;", "\342\252\255" },
+	{ "DotEqual;", "\342\211\220" },
+	{ "dotsquare;", "\342\212\241" },
+	{ "dzcy;", "\321\237" },
+	{ "Vdashl;", "\342\253\246" },
+	{ "vartheta;", "\317\221" },
+	{ "iiiint;", "\342\250\214" },
+	{ "dbkarow;", "\342\244\217" },
+	{ "And;", "\342\251\223" },
+	{ "sext;", "\342\234\266" },
+	{ "lurdshar;", "\342\245\212" },
+	{ "yfr;", "\360\235\224\266" },
+	{ "Prime;", "\342\200\263" },
+	{ "rdsh;", "\342\206\263" },
+	{ "planckh;", "\342\204\216" },
+	{ "complement;", "\342\210\201" },
+	{ "Pcy;", "\320\237" },
+	{ "simeq;", "\342\211\203" },
+	{ "varphi;", "\317\225" },
+	{ "nsupe;", "\342\212\211" },
+	{ "boxHD;", "\342\225\246" },
+	{ "rppolint;", "\342\250\222" },
+	{ "leftarrow;", "\342\206\220" },
+	{ "NotCongruent;", "\342\211\242" },
+	{ "RightArrow;", "\342\206\222" },
+	{ "lthree;", "\342\213\213" },
+	{ "IOcy;", "\320\201" },
+	{ "rightarrowtail;", "\342\206\243" },
+	{ "ohbar;", "\342\246\265" },
+	{ "vArr;", "\342\207\225" },
+	{ "NotRightTriangleEqual;", "\342\213\255" },
+	{ "sdote;", "\342\251\246" },
+	{ "lg;", "\342\211\266" },
+	{ "supe;", "\342\212\207" },
+	{ "NotPrecedesEqual;", "\342\252\257\314\270" },
+	{ "zfr;", "\360\235\224\267" },
+	{ "angmsdac;", "\342\246\252" },
+	{ "bprime;", "\342\200\265" },
+	{ "RightDownTeeVector;", "\342\245\235" },
+	{ "NotSucceedsEqual;", "\342\252\260\314\270" },
+	{ "cularr;", "\342\206\266" },
+	{ "wopf;", "\360\235\225\250" },
+	{ "prE;", "\342\252\263" },
+	{ "preceq;", "\342\252\257" },
+	{ "srarr;", "\342\206\222" },
+	{ "NotLeftTriangleEqual;", "\342\213\254" },
+	{ "rmoustache;", "\342\216\261" },
+	{ "nGg;", "\342\213\231\314\270" },
+	{ "rtriltri;", "\342\247\216" },
+	{ "latail;", "\342\244\231" },
+	{ "gtrdot;", "\342\213\227" },
+	{ "Egrave;", "\303\210" },
+	{ "blank;", "\342\220\243" },
+	{ "gEl;", "\342\252\214" },
+	{ "boxvr;", "\342\224\234" },
+	{ "agrave", "\303\240" },
+	{ "OverBrace;", "\342\217\236" },
+	{ "dashv;", "\342\212\243" },
+	{ "InvisibleComma;", "\342\201\243" },
+	{ "rightleftarrows;", "\342\207\204" },
+	{ "Colone;", "\342\251\264" },
+	{ "eqcolon;", "\342\211\225" },
+	{ "ddotseq;", "\342\251\267" },
+	{ "copy", "\302\251" },
+	{ "efDot;", "\342\211\222" },
+	{ "atilde;", "\303\243" },
+	{ "bsemi;", "\342\201\217" },
+	{ "iecy;", "\320\265" },
+	{ "gl;", "\342\211\267" },
+	{ "mdash;", "\342\200\224" },
+	{ "sigmav;", "\317\202" },
+	{ "ycirc;", "\305\267" },
+	{ "angmsdad;", "\342\246\253" },
+	{ "SquareSuperset;", "\342\212\220" },
+	{ "ges;", "\342\251\276" },
+	{ "qint;", "\342\250\214" },
+	{ "SquareIntersection;", "\342\212\223" },
+	{ "bigcap;", "\342\213\202" },
+	{ "Jopf;", "\360\235\225\201" },
+	{ "nleqslant;", "\342\251\275\314\270" },
+	{ "deg", "\302\260" },
+	{ "not", "\302\254" },
+	{ "lsimg;", "\342\252\217" },
+	{ "nscr;", "\360\235\223\203" },
+	{ "wr;", "\342\211\200" },
+	{ "thksim;", "\342\210\274" },
+	{ "acy;", "\320\260" },
+	{ "uuarr;", "\342\207\210" },
+	{ "Esim;", "\342\251\263" },
+	{ "subsub;", "\342\253\225" },
+	{ "prnE;", "\342\252\265" },
+	{ "between;", "\342\211\254" },
+	{ "sube;", "\342\212\206" },
+	{ "rbrack;", "]" },
+	{ "RightDoubleBracket;", "\342\237\247" },
+	{ "sqsube;", "\342\212\221" },
+	{ "jmath;", "\310\267" },
+	{ "PrecedesTilde;", "\342\211\276" },
+	{ "boxuR;", "\342\225\230" },
+	{ "RightTeeVector;", "\342\245\233" },
+	{ "Tcy;", "\320\242" },
+	{ "NotPrecedesSlantEqual;", "\342\213\240" },
+	{ "Lsh;", "\342\206\260" },
+	{ "profalar;", "\342\214\256" },
+	{ "bigtriangledown;", "\342\226\275" },
+	{ "lrarr;", "\342\207\206" },
+	{ "hfr;", "\360\235\224\245" },
+	{ "Supset;", "\342\213\221" },
+	{ "Kappa;", "\316\232" },
+	{ "elsdot;", "\342\252\227" },
+	{ "eng;", "\305\213" },
+	{ "bigtriangleup;", "\342\226\263" },
+	{ "Ocirc;", "\303\224" },
+	{ "Oscr;", "\360\235\222\252" },
+	{ "gfr;", "\360\235\224\244" },
+	{ "lhblk;", "\342\226\204" },
+	{ "lsqb;", "[" },
+	{ "Product;", "\342\210\217" },
+	{ "Iukcy;", "\320\206" },
+	{ "ap;", "\342\211\210" },
+	{ "SquareSubsetEqual;", "\342\212\221" },
+	{ "supdot;", "\342\252\276" },
+	{ "Beta;", "\316\222" },
+	{ "pr;", "\342\211\272" },
+	{ "Rcy;", "\320\240" },
+	{ "part;", "\342\210\202" },
+	{ "sfr;", "\360\235\224\260" },
+	{ "jscr;", "\360\235\222\277" },
+	{ "ogt;", "\342\247\201" },
+	{ "gtquest;", "\342\251\274" },
+	{ "ncap;", "\342\251\203" },
+	{ "Acirc", "\303\202" },
+	{ "Leftrightarrow;", "\342\207\224" },
+	{ "Rscr;", "\342\204\233" },
+	{ "uparrow;", "\342\206\221" },
+	{ "gesles;", "\342\252\224" },
+	{ "Poincareplane;", "\342\204\214" },
+	{ "nvlArr;", "\342\244\202" },
+	{ "Agrave;", "\303\200" },
+	{ "apid;", "\342\211\213" },
+	{ "vscr;", "\360\235\223\213" },
+	{ "boxdr;", "\342\224\214" },
+	{ "frac15;", "\342\205\225" },
+	{ "Barv;", "\342\253\247" },
+	{ "biguplus;", "\342\250\204" },
+	{ "sime;", "\342\211\203" },
+	{ "barwed;", "\342\214\205" },
+	{ "notniva;", "\342\210\214" },
+	{ "LeftVector;", "\342\206\274" },
+	{ "EmptyVerySmallSquare;", "\342\226\253" },
+	{ "loplus;", "\342\250\255" },
+	{ "Atilde", "\303\203" },
+	{ "gt", ">" },
+	{ "lowast;", "\342\210\227" },
+	{ "ecir;", "\342\211\226" },
+	{ "szlig", "\303\237" },
+	{ "Ecirc;", "\303\212" },
+	{ "rotimes;", "\342\250\265" },
+	{ "natur;", "\342\231\256" },
+	{ "LeftUpDownVector;", "\342\245\221" },
+	{ "NotReverseElement;", "\342\210\214" },
+	{ "ngeqslant;", "\342\251\276\314\270" },
+	{ "vopf;", "\360\235\225\247" },
+	{ "qopf;", "\360\235\225\242" },
+	{ "ltrie;", "\342\212\264" },
+	{ "gscr;", "\342\204\212" },
+	{ "propto;", "\342\210\235" },
+	{ "boxminus;", "\342\212\237" },
+	{ "ngsim;", "\342\211\265" },
+	{ "VDash;", "\342\212\253" },
+	{ "Mfr;", "\360\235\224\220" },
+	{ "lgE;", "\342\252\221" },
+	{ "suphsol;", "\342\237\211" },
+	{ "parsl;", "\342\253\275" },
+	{ "timesb;", "\342\212\240" },
+	{ "UnderBrace;", "\342\217\237" },
+	{ "Dashv;", "\342\253\244" },
+	{ "integers;", "\342\204\244" },
+	{ "brvbar", "\302\246" },
+	{ "DiacriticalDot;", "\313\231" },
+	{ "dtdot;", "\342\213\261" },
+	{ "curren", "\302\244" },
+	{ "vzigzag;", "\342\246\232" },
+	{ "xoplus;", "\342\250\201" },
+	{ "DiacriticalDoubleAcute;", "\313\235" },
+	{ "NotLessSlantEqual;", "\342\251\275\314\270" },
+	{ "RightArrowBar;", "\342\207\245" },
+	{ "Lleftarrow;", "\342\207\232" },
+	{ "Downarrow;", "\342\207\223" },
+	{ "gneq;", "\342\252\210" },
+	{ "NotTilde;", "\342\211\201" },
+	{ "gtreqqless;", "\342\252\214" },
+	{ "NotLess;", "\342\211\256" },
+	{ "oscr;", "\342\204\264" },
+	{ "lrtri;", "\342\212\277" },
+	{ "RightTee;", "\342\212\242" },
+	{ "CloseCurlyDoubleQuote;", "\342\200\235" },
+	{ "vartriangleright;", "\342\212\263" },
+	{ "af;", "\342\201\241" },
+	{ "nltri;", "\342\213\252" },
+	{ "uArr;", "\342\207\221" },
+	{ "Utilde;", "\305\250" },
+	{ "gne;", "\342\252\210" },
+	{ "NoBreak;", "\342\201\240" },
+	{ "boxul;", "\342\224\230" },
+	{ "OpenCurlyQuote;", "\342\200\230" },
+	{ "Leftarrow;", "\342\207\220" },
+	{ "subset;", "\342\212\202" },
+	{ "RightCeiling;", "\342\214\211" },
+	{ "subsetneqq;", "\342\253\213" },
+	{ "NotRightTriangle;", "\342\213\253" },
+	{ "vsubne;", "\342\212\212\357\270\200" },
+	{ "frac34;", "\302\276" },
+	{ "eqcirc;", "\342\211\226" },
+	{ "sdotb;", "\342\212\241" },
+	{ "frac16;", "\342\205\231" },
+	{ "djcy;", "\321\222" },
+	{ "NotTildeEqual;", "\342\211\204" },
+	{ "SucceedsSlantEqual;", "\342\211\275" },
+	{ "gtrapprox;", "\342\252\206" },
+	{ "xrarr;", "\342\237\266" },
+	{ "Ccedil", "\303\207" },
+	{ "nequiv;", "\342\211\242" },
+	{ "Bopf;", "\360\235\224\271" },
+	{ "forkv;", "\342\253\231" },
+	{ "Qscr;", "\360\235\222\254" },
+	{ "sharp;", "\342\231\257" },
+	{ "eplus;", "\342\251\261" },
+	{ "cwconint;", "\342\210\262" },
+	{ "lpar;", "(" },
+	{ "RightFloor;", "\342\214\213" },
+	{ "topcir;", "\342\253\261" },
+	{ "UnionPlus;", "\342\212\216" },
+	{ "cuvee;", "\342\213\216" },
+	{ "els;", "\342\252\225" },
+	{ "loz;", "\342\227\212" },
+	{ "vDash;", "\342\212\250" },
+	{ "lesdotor;", "\342\252\203" },
+	{ "Uopf;", "\360\235\225\214" },
+	{ "eqslantgtr;", "\342\252\226" },
+	{ "duhar;", "\342\245\257" },
+	{ "sup1", "\302\271" },
+	{ "prop;", "\342\210\235" },
+	{ "triplus;", "\342\250\271" },
+	{ "SOFTcy;", "\320\254" },
+	{ "swArr;", "\342\207\231" },
+	{ "quot;", "\042" },
+	{ "hookrightarrow;", "\342\206\252" },
+	{ "mDDot;", "\342\210\272" },
+	{ "boxvh;", "\342\224\274" },
+	{ "GreaterEqual;", "\342\211\245" },
+	{ "rightharpoondown;", "\342\207\201" },
+	{ "gsim;", "\342\211\263" },
+	{ "Oacute", "\303\223" },
+	{ "roplus;", "\342\250\256" },
+	{ "fopf;", "\360\235\225\227" },
+	{ "LT;", "<" },
+	{ "plusmn;", "\302\261" },
+	{ "circlearrowright;", "\342\206\273" },
+	{ "odsold;", "\342\246\274" },
+	{ "eqsim;", "\342\211\202" },
+	{ "boxVr;", "\342\225\237" },
+	{ "ouml;", "\303\266" },
+	{ "szlig;", "\303\237" },
+	{ "ograve", "\303\262" },
+	{ "dcaron;", "\304\217" },
+	{ "nwarhk;", "\342\244\243" },
+	{ "mopf;", "\360\235\225\236" },
+	{ "SHcy;", "\320\250" },
+	{ "awconint;", "\342\210\263" },
+	{ "tscr;", "\360\235\223\211" },
+	{ "rsh;", "\342\206\261" },
+	{ "lozf;", "\342\247\253" },
+	{ "Vdash;", "\342\212\251" },
+	{ "rsaquo;", "\342\200\272" },
+	{ "disin;", "\342\213\262" },
+	{ "SucceedsTilde;", "\342\211\277" },
+	{ "ropar;", "\342\246\206" },
+	{ "Wscr;", "\360\235\222\262" },
+	{ "NotGreaterGreater;", "\342\211\253\314\270" },
+	{ "KHcy;", "\320\245" },
+	{ "bigvee;", "\342\213\201" },
+	{ "luruhar;", "\342\245\246" },
+	{ "lagran;", "\342\204\222" },
+	{ "gvnE;", "\342\211\251\357\270\200" },
+	{ "rtri;", "\342\226\271" },
+	{ "Ufr;", "\360\235\224\230" },
+	{ "exist;", "\342\210\203" },
+	{ "mlcp;", "\342\253\233" },
+	{ "duarr;", "\342\207\265" },
+	{ "frac58;", "\342\205\235" },
+	{ "lstrok;", "\305\202" },
+	{ "udhar;", "\342\245\256" },
+	{ "bbrktbrk;", "\342\216\266" },
+	{ "measuredangle;", "\342\210\241" },
+	{ "trisb;", "\342\247\215" },
+	{ "chi;", "\317\207" },
+	{ "bigcirc;", "\342\227\257" },
+	{ "angst;", "\303\205" },
+	{ "gesl;", "\342\213\233\357\270\200" },
+	{ "Nacute;", "\305\203" },
+	{ "larrhk;", "\342\206\251" },
+	{ "succeq;", "\342\252\260" },
+	{ "tshcy;", "\321\233" },
+	{ "seArr;", "\342\207\230" },
+	{ "tcaron;", "\305\245" },
+	{ "nsupseteqq;", "\342\253\206\314\270" },
+	{ "nVdash;", "\342\212\256" },
+	{ "Lstrok;", "\305\201" },
+	{ "Ecirc", "\303\212" },
+	{ "npreceq;", "\342\252\257\314\270" },
+	{ "nis;", "\342\213\274" },
+	{ "angmsd;", "\342\210\241" },
+	{ "DoubleLeftRightArrow;", "\342\207\224" },
+	{ "NotHumpEqual;", "\342\211\217\314\270" },
+	{ "chcy;", "\321\207" },
+	{ "lrhard;", "\342\245\255" },
+	{ "thicksim;", "\342\210\274" },
+	{ "notinva;", "\342\210\211" },
+	{ "nldr;", "\342\200\245" },
+	{ "rightsquigarrow;", "\342\206\235" },
+	{ "rpargt;", "\342\246\224" },
+	{ "thorn", "\303\276" },
+	{ "supseteq;", "\342\212\207" },
+	{ "boxDl;", "\342\225\226" },
+	{ "Otilde;", "\303\225" },
+	{ "lessdot;", "\342\213\226" },
+	{ "Popf;", "\342\204\231" },
+	{ "Ograve;", "\303\222" },
+	{ "lang;", "\342\237\250" },
+	{ "rarrfs;", "\342\244\236" },
+	{ "middot", "\302\267" },
+	{ "backsimeq;", "\342\213\215" },
+	{ "DifferentialD;", "\342\205\206" },
+	{ "UpArrowDownArrow;", "\342\207\205" },
+	{ "OpenCurlyDoubleQuote;", "\342\200\234" },
+	{ "CupCap;", "\342\211\215" },
+	{ "urtri;", "\342\227\271" },
+	{ "gtlPar;", "\342\246\225" },
+	{ "Acirc;", "\303\202" },
+	{ "icy;", "\320\270" },
+	{ "gcy;", "\320\263" },
+	{ "ecirc;", "\303\252" },
+	{ "FilledVerySmallSquare;", "\342\226\252" },
+	{ "Afr;", "\360\235\224\204" },
+	{ "sqsubset;", "\342\212\217" },
+	{ "dfr;", "\360\235\224\241" },
+	{ "rcaron;", "\305\231" },
+	{ "ReverseEquilibrium;", "\342\207\213" },
+	{ "DownArrowBar;", "\342\244\223" },
+	{ "shy", "\302\255" },
+	{ "vsubnE;", "\342\253\213\357\270\200" },
+	{ "ofcir;", "\342\246\277" },
+	{ "yuml", "\303\277" },
+	{ "cfr;", "\360\235\224\240" },
+	{ "Ecy;", "\320\255" },
+	{ "amacr;", "\304\201" },
+	{ "TildeTilde;", "\342\211\210" },
+	{ "vrtri;", "\342\212\263" },
+	{ "nshortmid;", "\342\210\244" },
+	{ "ReverseUpEquilibrium;", "\342\245\257" },
+	{ "longleftrightarrow;", "\342\237\267" },
+	{ "shortparallel;", "\342\210\245" },
+	{ "ngeqq;", "\342\211\247\314\270" },
+	{ "Int;", "\342\210\254" },
+	{ "spades;", "\342\231\240" },
+	{ "boxH;", "\342\225\220" },
+	{ "bigwedge;", "\342\213\200" },
+	{ "aopf;", "\360\235\225\222" },
+	{ "therefore;", "\342\210\264" },
+	{ "angrtvb;", "\342\212\276" },
+	{ "sung;", "\342\231\252" },
+	{ "Icirc", "\303\216" },
+	{ "nu;", "\316\275" },
+	{ "Verbar;", "\342\200\226" },
+	{ "Sopf;", "\360\235\225\212" },
+	{ "hslash;", "\342\204\217" },
+	{ "or;", "\342\210\250" },
+	{ "nLtv;", "\342\211\252\314\270" },
+	{ "larrb;", "\342\207\244" },
+	{ "Racute;", "\305\224" },
+	{ "VerticalSeparator;", "\342\235\230" },
+	{ "cupcap;", "\342\251\206" },
+	{ "iukcy;", "\321\226" },
+	{ "iogon;", "\304\257" },
+	{ "solb;", "\342\247\204" },
+	{ "slarr;", "\342\206\220" },
+	{ "heartsuit;", "\342\231\245" },
+	{ "leqq;", "\342\211\246" },
+	{ "Dstrok;", "\304\220" },
+	{ "vprop;", "\342\210\235" },
+	{ "Integral;", "\342\210\253" },
+	{ "minusb;", "\342\212\237" },
+	{ "HorizontalLine;", "\342\224\200" },
+	{ "leq;", "\342\211\244" },
+	{ "plusmn", "\302\261" },
+	{ "straightepsilon;", "\317\265" },
+	{ "npar;", "\342\210\246" },
+	{ "nang;", "\342\210\240\342\203\222" },
+	{ "tcy;", "\321\202" },
+	{ "supnE;", "\342\253\214" },
+	{ "precsim;", "\342\211\276" },
+	{ "bull;", "\342\200\242" },
+	{ "Mellintrf;", "\342\204\263" },
+	{ "LeftTriangle;", "\342\212\262" },
+	{ "Tstrok;", "\305\246" },
+	{ "nvap;", "\342\211\215\342\203\222" },
+	{ "SmallCircle;", "\342\210\230" },
+	{ "delta;", "\316\264" },
+	{ "downarrow;", "\342\206\223" },
+	{ "numero;", "\342\204\226" },
+	{ "uuml;", "\303\274" },
+	{ "Alpha;", "\316\221" },
+	{ "reg", "\302\256" },
+	{ "gla;", "\342\252\245" },
+	{ "dsol;", "\342\247\266" },
+	{ "odash;", "\342\212\235" },
+	{ "ctdot;", "\342\213\257" },
+	{ "lnapprox;", "\342\252\211" },
+	{ "tscy;", "\321\206" },
+	{ "supdsub;", "\342\253\230" },
+	{ "Proportion;", "\342\210\267" },
+	{ "varsubsetneqq;", "\342\253\213\357\270\200" },
+	{ "PrecedesSlantEqual;", "\342\211\274" },
+	{ "horbar;", "\342\200\225" },
+	{ "NegativeMediumSpace;", "\342\200\213" },
+	{ "EqualTilde;", "\342\211\202" },
+	{ "isins;", "\342\213\264" },
+	{ "rx;", "\342\204\236" },
+	{ "rarrtl;", "\342\206\243" },
+	{ "Lacute;", "\304\271" },
+	{ "roarr;", "\342\207\276" },
+	{ "gimel;", "\342\204\267" },
+	{ "mumap;", "\342\212\270" },
+	{ "cir;", "\342\227\213" },
+	{ "preccurlyeq;", "\342\211\274" },
+	{ "plustwo;", "\342\250\247" },
+	{ "NegativeThickSpace;", "\342\200\213" },
+	{ "Ifr;", "\342\204\221" },
+	{ "HARDcy;", "\320\252" },
+	{ "ne;", "\342\211\240" },
+	{ "lat;", "\342\252\253" },
+	{ "lnE;", "\342\211\250" },
+	{ "ShortUpArrow;", "\342\206\221" },
+	{ "DZcy;", "\320\217" },
+	{ "lArr;", "\342\207\220" },
+	{ "prnsim;", "\342\213\250" },
+	{ "Cdot;", "\304\212" },
+	{ "PartialD;", "\342\210\202" },
+	{ "gjcy;", "\321\223" },
+	{ "amp", "&" },
+	{ "cedil", "\302\270" },
+	{ "frac45;", "\342\205\230" },
+	{ "cirscir;", "\342\247\202" },
+	{ "nvrtrie;", "\342\212\265\342\203\222" },
+	{ "xhArr;", "\342\237\272" },
+	{ "smtes;", "\342\252\254\357\270\200" },
+	{ "ldquo;", "\342\200\234" },
+	{ "subsim;", "\342\253\207" },
+	{ "Ll;", "\342\213\230" },
+	{ "sigmaf;", "\317\202" },
+	{ "supsetneqq;", "\342\253\214" },
+	{ "ofr;", "\360\235\224\254" },
+	{ "profline;", "\342\214\222" },
+	{ "zeetrf;", "\342\204\250" },
+	{ "Nscr;", "\360\235\222\251" },
+	{ "Lfr;", "\360\235\224\217" },
+	{ "sqcaps;", "\342\212\223\357\270\200" },
+	{ "Laplacetrf;", "\342\204\222" },
+	{ "ssetmn;", "\342\210\226" },
+	{ "qfr;", "\360\235\224\256" },
+	{ "Yacute;", "\303\235" },
+	{ "Fopf;", "\360\235\224\275" },
+	{ "khcy;", "\321\205" },
+	{ "SucceedsEqual;", "\342\252\260" },
+	{ "larrpl;", "\342\244\271" },
+	{ "nsucc;", "\342\212\201" },
+	{ "Wcirc;", "\305\264" },
+	{ "lfr;", "\360\235\224\251" },
+	{ "lAarr;", "\342\207\232" },
+	{ "lvertneqq;", "\342\211\250\357\270\200" },
+	{ "olt;", "\342\247\200" },
+	{ "downdownarrows;", "\342\207\212" },
+	{ "urcorner;", "\342\214\235" },
+	{ "micro;", "\302\265" },
+	{ "frac78;", "\342\205\236" },
+	{ "Vvdash;", "\342\212\252" },
+	{ "Ccirc;", "\304\210" },
+	{ "cong;", "\342\211\205" },
+	{ "Ocy;", "\320\236" },
+	{ "auml", "\303\244" },
+	{ "drbkarow;", "\342\244\220" },
+	{ "xwedge;", "\342\213\200" },
+	{ "yen;", "\302\245" },
+	{ "Rightarrow;", "\342\207\222" },
+	{ "orslope;", "\342\251\227" },
+	{ "lcaron;", "\304\276" },
+	{ "topbot;", "\342\214\266" },
+	{ "Scy;", "\320\241" },
+	{ "doteq;", "\342\211\220" },
+	{ "lsaquo;", "\342\200\271" },
+	{ "SquareUnion;", "\342\212\224" },
+	{ "comp;", "\342\210\201" },
+	{ "rarrhk;", "\342\206\252" },
+	{ "Igrave", "\303\214" },
+	{ "gt;", ">" },
+	{ "opar;", "\342\246\267" },
+	{ "softcy;", "\321\214" },
+	{ "angsph;", "\342\210\242" },
+	{ "trianglerighteq;", "\342\212\265" },
+	{ "ccedil;", "\303\247" },
+	{ "succsim;", "\342\211\277" },
+	{ "NotGreaterFullEqual;", "\342\211\247\314\270" },
+	{ "nearhk;", "\342\244\244" },
+	{ "breve;", "\313\230" },
+	{ "egs;", "\342\252\226" },
+	{ "ac;", "\342\210\276" },
+	{ "rarrpl;", "\342\245\205" },
+	{ "Fscr;", "\342\204\261" },
+	{ "semi;", ";" },
+	{ "ldca;", "\342\244\266" },
+	{ "egsdot;", "\342\252\230" },
+	{ "DD;", "\342\205\205" },
+	{ "nvsim;", "\342\210\274\342\203\222" },
+	{ "nrarrw;", "\342\206\235\314\270" },
+	{ "Ucirc", "\303\233" },
+	{ "Gscr;", "\360\235\222\242" },
+	{ "divideontimes;", "\342\213\207" },
+	{ "boxvl;", "\342\224\244" },
+	{ "ecirc", "\303\252" },
+	{ "scnap;", "\342\252\272" },
+	{ "HumpEqual;", "\342\211\217" },
+	{ "updownarrow;", "\342\206\225" },
+	{ "ordf", "\302\252" },
+	{ "RightTeeArrow;", "\342\206\246" },
+	{ "emsp13;", "\342\200\204" },
+	{ "caron;", "\313\207" },
+	{ "rarrsim;", "\342\245\264" },
+	{ "oline;", "\342\200\276" },
+	{ "fjlig;", "fj" },
+	{ "andd;", "\342\251\234" },
+	{ "FilledSmallSquare;", "\342\227\274" },
+	{ "ZeroWidthSpace;", "\342\200\213" },
+	{ "trianglelefteq;", "\342\212\264" },
+	{ "dHar;", "\342\245\245" },
+	{ "Map;", "\342\244\205" },
+	{ "xutri;", "\342\226\263" },
+	{ "frac34", "\302\276" },
+	{ "Ropf;", "\342\204\235" },
+	{ "NotLessGreater;", "\342\211\270" },
+	{ "UpperLeftArrow;", "\342\206\226" },
+	{ "hopf;", "\360\235\225\231" },
+	{ "LeftDownTeeVector;", "\342\245\241" },
+	{ "ldquor;", "\342\200\236" },
+	{ "RightDownVectorBar;", "\342\245\225" },
+	{ "precnapprox;", "\342\252\271" },
+	{ "para;", "\302\266" },
+	{ "Re;", "\342\204\234" },
+	{ "iota;", "\316\271" },
+	{ "ltcir;", "\342\251\271" },
+	{ "CircleTimes;", "\342\212\227" },
+	{ "thetasym;", "\317\221" },
+	{ "nsubE;", "\342\253\205\314\270" },
+	{ "SquareSubset;", "\342\212\217" },
+	{ "plusb;", "\342\212\236" },
+	{ "lesssim;", "\342\211\262" },
+	{ "sdot;", "\342\213\205" },
+	{ "nsubset;", "\342\212\202\342\203\222" },
+	{ "LeftDownVectorBar;", "\342\245\231" },
+	{ "langle;", "\342\237\250" },
+	{ "Del;", "\342\210\207" },
+	{ "mp;", "\342\210\223" },
+	{ "ntriangleleft;", "\342\213\252" },
+	{ "eqvparsl;", "\342\247\245" },
+	{ "Igrave;", "\303\214" },
+	{ "QUOT", "\042" },
+	{ "wcirc;", "\305\265" },
+	{ "bowtie;", "\342\213\210" },
+	{ "vsupne;", "\342\212\213\357\270\200" },
+	{ "nRightarrow;", "\342\207\217" },
+	{ "sstarf;", "\342\213\206" },
+	{ "ltdot;", "\342\213\226" },
+	{ "sscr;", "\360\235\223\210" },
+	{ "orarr;", "\342\206\273" },
+	{ "glE;", "\342\252\222" },
+	{ "rationals;", "\342\204\232" },
+	{ "uwangle;", "\342\246\247" },
+	{ "quot", "\042" },
+	{ "circledast;", "\342\212\233" },
+	{ "rBarr;", "\342\244\217" },
+	{ "emptyset;", "\342\210\205" },
+	{ "nsim;", "\342\211\201" },
+	{ "theta;", "\316\270" },
+	{ "rsqb;", "]" },
+	{ "yuml;", "\303\277" },
+	{ "gE;", "\342\211\247" },
+	{ "boxVH;", "\342\225\254" },
+	{ "supne;", "\342\212\213" },
+	{ "gtcir;", "\342\251\272" },
+	{ "ordm;", "\302\272" },
+	{ "Intersection;", "\342\213\202" },
+	{ "Epsilon;", "\316\225" },
+	{ "Agrave", "\303\200" },
+	{ "ntrianglerighteq;", "\342\213\255" },
+	{ "diams;", "\342\231\246" },
+	{ "acirc;", "\303\242" },
+	{ "ecolon;", "\342\211\225" },
+	{ "lap;", "\342\252\205" },
+	{ "sum;", "\342\210\221" },
+	{ "coloneq;", "\342\211\224" },
+	{ "Xscr;", "\360\235\222\263" },
+	{ "DownLeftVector;", "\342\206\275" },
+	{ "cupdot;", "\342\212\215" },
+	{ "Acy;", "\320\220" },
+	{ "aring", "\303\245" },
+	{ "permil;", "\342\200\260" },
+	{ "vdash;", "\342\212\242" },
+	{ "eopf;", "\360\235\225\226" },
+	{ "lbrkslu;", "\342\246\215" },
+	{ "rho;", "\317\201" },
+	{ "gap;", "\342\252\206" },
+	{ "sub;", "\342\212\202" },
+	{ "vnsub;", "\342\212\202\342\203\222" },
+	{ "digamma;", "\317\235" },
+	{ "odiv;", "\342\250\270" },
+	{ "ecaron;", "\304\233" },
+	{ "vfr;", "\360\235\224\263" },
+	{ "Edot;", "\304\226" },
+	{ "geqslant;", "\342\251\276" },
+	{ "lmoust;", "\342\216\260" },
+	{ "topfork;", "\342\253\232" },
+	{ "ngE;", "\342\211\247\314\270" },
+	{ "Dagger;", "\342\200\241" },
+	{ "Bernoullis;", "\342\204\254" },
+	{ "quest;", "\077" },
+	{ "nsqsupe;", "\342\213\243" },
+	{ "rightharpoonup;", "\342\207\200" },
+	{ "upharpoonleft;", "\342\206\277" },
+	{ "loarr;", "\342\207\275" },
+	{ "phiv;", "\317\225" },
+	{ "COPY", "\302\251" },
+	{ "leftrightharpoons;", "\342\207\213" },
+	{ "mho;", "\342\204\247" },
+	{ "raemptyv;", "\342\246\263" },
+	{ "top;", "\342\212\244" },
+	{ "GreaterSlantEqual;", "\342\251\276" },
+	{ "block;", "\342\226\210" },
+	{ "pitchfork;", "\342\213\224" },
+	{ "questeq;", "\342\211\237" },
+	{ "itilde;", "\304\251" },
+	{ "xlarr;", "\342\237\265" },
+	{ "Icirc;", "\303\216" },
+	{ "atilde", "\303\243" },
+	{ "lambda;", "\316\273" },
+	{ "nleq;", "\342\211\260" },
+	{ "varpi;", "\317\226" },
+	{ "ForAll;", "\342\210\200" },
+	{ "pointint;", "\342\250\225" },
+	{ "NotElement;", "\342\210\211" },
+	{ "CloseCurlyQuote;", "\342\200\231" },
+	{ "bumpE;", "\342\252\256" },
+	{ "cirmid;", "\342\253\257" },
+	{ "capcup;", "\342\251\207" },
+	{ "iacute;", "\303\255" },
+	{ "loang;", "\342\237\254" },
+	{ "NotDoubleVerticalBar;", "\342\210\246" },
+	{ "Succeeds;", "\342\211\273" },
+	{ "IEcy;", "\320\225" },
+	{ "Zcy;", "\320\227" },
+	{ "iiota;", "\342\204\251" },
+	{ "gesdoto;", "\342\252\202" },
+	{ "equiv;", "\342\211\241" },
+	{ "yacute;", "\303\275" },
+	{ "ShortLeftArrow;", "\342\206\220" },
+	{ "raquo;", "\302\273" },
+	{ "ETH;", "\303\220" },
+	{ "Or;", "\342\251\224" },
+	{ "RightTriangleEqual;", "\342\212\265" },
+	{ "Atilde;", "\303\203" },
+	{ "ldrdhar;", "\342\245\247" },
+	{ "backprime;", "\342\200\265" },
+	{ "THORN", "\303\236" },
+	{ "bfr;", "\360\235\224\237" },
+	{ "hbar;", "\342\204\217" },
+	{ "sc;", "\342\211\273" },
+	{ "eqslantless;", "\342\252\225" },
+	{ "VerticalBar;", "\342\210\243" },
+	{ "Jscr;", "\360\235\222\245" },
+	{ "nLeftarrow;", "\342\207\215" },
+	{ "lopar;", "\342\246\205" },
+	{ "LeftArrow;", "\342\206\220" },
+	{ "harrcir;", "\342\245\210" },
+	{ "profsurf;", "\342\214\223" },
+	{ "CirclePlus;", "\342\212\225" },
+	{ "Odblac;", "\305\220" },
+	{ "varsupsetneq;", "\342\212\213\357\270\200" },
+	{ "dwangle;", "\342\246\246" },
+	{ "xrArr;", "\342\237\271" },
+	{ "Ycirc;", "\305\266" },
+	{ "NotLessEqual;", "\342\211\260" },
+	{ "amp;", "&" },
+	{ "ssmile;", "\342\214\243" },
+	{ "vsupnE;", "\342\253\214\357\270\200" },
+	{ "UpTee;", "\342\212\245" },
+	{ "vangrt;", "\342\246\234" },
+	{ "CounterClockwiseContourIntegral;", "\342\210\263" },
+	{ "eacute", "\303\251" },
+	{ "simdot;", "\342\251\252" },
+	{ "AMP;", "&" },
+	{ "rarrbfs;", "\342\244\240" },
+	{ "curvearrowleft;", "\342\206\266" },
+	{ "boxHu;", "\342\225\247" },
+	{ "ange;", "\342\246\244" },
+	{ "comma;", "," },
+	{ "nsime;", "\342\211\204" },
+	{ "copysr;", "\342\204\227" },
+	{ "TScy;", "\320\246" },
+	{ "yacute", "\303\275" },
+	{ "csupe;", "\342\253\222" },
+	{ "LeftDoubleBracket;", "\342\237\246" },
+	{ "daleth;", "\342\204\270" },
+	{ "ring;", "\313\232" },
+	{ "varr;", "\342\206\225" },
+	{ "wscr;", "\360\235\223\214" },
+	{ "aelig;", "\303\246" },
+	{ "bsol;", "\134" },
+	{ "rfr;", "\360\235\224\257" },
+	{ "notin;", "\342\210\211" },
+	{ "el;", "\342\252\231" },
+	{ "GreaterEqualLess;", "\342\213\233" },
+	{ "nhpar;", "\342\253\262" },
+	{ "wedge;", "\342\210\247" },
+	{ "curren;", "\302\244" },
+	{ "ImaginaryI;", "\342\205\210" },
+	{ "fscr;", "\360\235\222\273" },
+	{ "napid;", "\342\211\213\314\270" },
+	{ "there4;", "\342\210\264" },
+	{ "LeftTeeVector;", "\342\245\232" },
+	{ "LJcy;", "\320\211" },
+	{ "suplarr;", "\342\245\273" },
+	{ "ntriangleright;", "\342\213\253" },
+	{ "NotPrecedes;", "\342\212\200" },
+	{ "nbsp;", "\302\240" },
+	{ "dot;", "\313\231" },
+	{ "Hopf;", "\342\204\215" },
+	{ "Zfr;", "\342\204\250" },
+	{ "omicron;", "\316\277" },
+	{ "NotSquareSupersetEqual;", "\342\213\243" },
+	{ "uacute", "\303\272" },
+	{ "timesbar;", "\342\250\261" },
+	{ "Hstrok;", "\304\246" },
+	{ "lesdot;", "\342\251\277" },
+	{ "esim;", "\342\211\202" },
+	{ "DJcy;", "\320\202" },
+	{ "reals;", "\342\204\235" },
+	{ "Vopf;", "\360\235\225\215" },
+	{ "eth", "\303\260" },
+	{ "Jcy;", "\320\231" },
+	{ "nhArr;", "\342\207\216" },
+	{ "acute", "\302\264" },
+	{ "raquo", "\302\273" },
+	{ "DownRightTeeVector;", "\342\245\237" },
+	{ "Ascr;", "\360\235\222\234" },
+	{ "NotTildeTilde;", "\342\211\211" },
+	{ "ugrave;", "\303\271" },
+	{ "Oslash;", "\303\230" },
+	{ "tcedil;", "\305\243" },
+	{ "exponentiale;", "\342\205\207" },
+	{ "geq;", "\342\211\245" },
+	{ "mapstoup;", "\342\206\245" },
+	{ "sqcap;", "\342\212\223" },
+	{ "rtrif;", "\342\226\270" },
+	{ "origof;", "\342\212\266" },
+	{ "Superset;", "\342\212\203" },
+	{ "oslash;", "\303\270" },
+	{ "Ucirc;", "\303\233" },
+	{ "DDotrahd;", "\342\244\221" },
+	{ "rbrkslu;", "\342\246\220" },
+	{ "nvdash;", "\342\212\254" },
+	{ "ratio;", "\342\210\266" },
+	{ "laemptyv;", "\342\246\264" },
+	{ "ccupssm;", "\342\251\220" },
+	{ "boxvL;", "\342\225\241" },
+	{ "emsp;", "\342\200\203" },
+	{ "utrif;", "\342\226\264" },
+	{ "frac18;", "\342\205\233" },
+	{ "urcrop;", "\342\214\216" },
+	{ "mscr;", "\360\235\223\202" },
+	{ "oslash", "\303\270" },
+	{ "Mcy;", "\320\234" },
+	{ "precnsim;", "\342\213\250" },
+	{ "kgreen;", "\304\270" },
+	{ "smt;", "\342\252\252" },
+	{ "wfr;", "\360\235\224\264" },
+	{ "phmmat;", "\342\204\263" },
+	{ "dfisht;", "\342\245\277" },
+	{ "sigma;", "\317\203" },
+	{ "nbumpe;", "\342\211\217\314\270" },
+	{ "smid;", "\342\210\243" },
+	{ "boxhU;", "\342\225\250" },
+	{ "numsp;", "\342\200\207" },
+	{ "scpolint;", "\342\250\223" },
+	{ "not;", "\302\254" },
+	{ "rarrw;", "\342\206\235" },
+	{ "xuplus;", "\342\250\204" },
+	{ "curarrm;", "\342\244\274" },
+	{ "nvrArr;", "\342\244\203" },
+	{ "nlsim;", "\342\211\264" },
+	{ "lbrksld;", "\342\246\217" },
+	{ "triangleleft;", "\342\227\203" },
+	{ "order;", "\342\204\264" },
+	{ "sim;", "\342\210\274" },
+	{ "scaron;", "\305\241" },
+	{ "mapstoleft;", "\342\206\244" },
+	{ "Iogon;", "\304\256" },
+	{ "Ccedil;", "\303\207" },
+	{ "LeftArrowBar;", "\342\207\244" },
+	{ "rbrke;", "\342\246\214" },
+	{ "image;", "\342\204\221" },
+	{ "gsime;", "\342\252\216" },
+	{ "niv;", "\342\210\213" },
+	{ "NotLessLess;", "\342\211\252\314\270" },
+	{ "hoarr;", "\342\207\277" },
+	{ "ltrPar;", "\342\246\226" },
+	{ "Kopf;", "\360\235\225\202" },
+	{ "Xfr;", "\360\235\224\233" },
+	{ "NotSuperset;", "\342\212\203\342\203\222" },
+	{ "scnsim;", "\342\213\251" },
+	{ "iscr;", "\360\235\222\276" },
+	{ "sup1;", "\302\271" },
+	{ "angle;", "\342\210\240" },
+	{ "larrbfs;", "\342\244\237" },
+	{ "ascr;", "\360\235\222\266" },
+	{ "trie;", "\342\211\234" },
+	{ "reg;", "\302\256" },
+	{ "NotNestedGreaterGreater;", "\342\252\242\314\270" },
+	{ "subsetneq;", "\342\212\212" },
+	{ "Sqrt;", "\342\210\232" },
+	{ "lt;", "<" },
+	{ "bigotimes;", "\342\250\202" },
+	{ "blacktriangleleft;", "\342\227\202" },
+	{ "blk14;", "\342\226\221" },
+	{ "eparsl;", "\342\247\243" },
+	{ "ufr;", "\360\235\224\262" },
+	{ "lhard;", "\342\206\275" },
+	{ "seswar;", "\342\244\251" },
+	{ "Ccaron;", "\304\214" },
+	{ "napos;", "\305\211" },
+	{ "Lmidot;", "\304\277" },
+	{ "prod;", "\342\210\217" },
+	{ "cirE;", "\342\247\203" },
+	{ "Mscr;", "\342\204\263" },
+	{ "xdtri;", "\342\226\275" },
+	{ "nlArr;", "\342\207\215" },
+	{ "nesear;", "\342\244\250" },
+	{ "bernou;", "\342\204\254" },
+	{ "ccups;", "\342\251\214" },
+	{ "longmapsto;", "\342\237\274" },
+	{ "bcy;", "\320\261" },
+	{ "pcy;", "\320\277" },
+	{ "Amacr;", "\304\200" },
+	{ "LeftVectorBar;", "\342\245\222" },
+	{ "THORN;", "\303\236" },
+	{ "cularrp;", "\342\244\275" },
+	{ "cups;", "\342\210\252\357\270\200" },
+	{ "ddagger;", "\342\200\241" },
+	{ "supplus;", "\342\253\200" },
+	{ "frac13;", "\342\205\223" },
+	{ "dscr;", "\360\235\222\271" },
+	{ "uring;", "\305\257" },
+	{ "longleftarrow;", "\342\237\265" },
+	{ "yscr;", "\360\235\223\216" },
+	{ "NJcy;", "\320\212" },
+	{ "Ofr;", "\360\235\224\222" },
+	{ "utilde;", "\305\251" },
+	{ "Otimes;", "\342\250\267" },
+	{ "angzarr;", "\342\215\274" },
+	{ "ominus;", "\342\212\226" },
+	{ "cupcup;", "\342\251\212" },
+	{ "afr;", "\360\235\224\236" },
+	{ "cudarrr;", "\342\244\265" },
+	{ "nbsp", "\302\240" },
+	{ "Zopf;", "\342\204\244" },
+	{ "Jukcy;", "\320\204" },
+	{ "thetav;", "\317\221" },
+	{ "divonx;", "\342\213\207" },
+	{ "nsubseteq;", "\342\212\210" },
+	{ "CircleMinus;", "\342\212\226" },
+	{ "drcrop;", "\342\214\214" },
+	{ "Conint;", "\342\210\257" },
+	{ "nge;", "\342\211\261" },
+	{ "cirfnint;", "\342\250\220" },
+	{ "boxVL;", "\342\225\243" },
+	{ "Equilibrium;", "\342\207\214" },
+	{ "smeparsl;", "\342\247\244" },
+	{ "DiacriticalAcute;", "\302\264" },
+	{ "Vscr;", "\360\235\222\261" },
+	{ "gamma;", "\316\263" },
+	{ "rightrightarrows;", "\342\207\211" },
+	{ "Ecaron;", "\304\232" },
+	{ "tau;", "\317\204" },
+	{ "DownArrow;", "\342\206\223" },
+	{ "ltcc;", "\342\252\246" },
+	{ "nearrow;", "\342\206\227" },
+	{ "star;", "\342\230\206" },
+	{ "rbarr;", "\342\244\215" },
+	{ "Psi;", "\316\250" },
+	{ "lcy;", "\320\273" },
+	{ "Exists;", "\342\210\203" },
+	{ "capbrcup;", "\342\251\211" },
+	{ "lesseqqgtr;", "\342\252\213" },
+	{ "succcurlyeq;", "\342\211\275" },
+	{ "sqcup;", "\342\212\224" },
+	{ "doteqdot;", "\342\211\221" },
+	{ "ropf;", "\360\235\225\243" },
+	{ "ExponentialE;", "\342\205\207" },
+	{ "NotSucceedsTilde;", "\342\211\277\314\270" },
+	{ "odblac;", "\305\221" },
+	{ "nleftarrow;", "\342\206\232" },
+	{ "LessFullEqual;", "\342\211\246" },
+	{ "RBarr;", "\342\244\220" },
+	{ "bcong;", "\342\211\214" },
+	{ "minus;", "\342\210\222" },
+	{ "UpEquilibrium;", "\342\245\256" },
+	{ "Theta;", "\316\230" },
+	{ "varrho;", "\317\261" },
+	{ "Pi;", "\316\240" },
+	{ "xsqcup;", "\342\250\206" },
+	{ "Uacute;", "\303\232" },
+	{ "upsi;", "\317\205" },
+	{ "popf;", "\360\235\225\241" },
+	{ "straightphi;", "\317\225" },
+	{ "SquareSupersetEqual;", "\342\212\222" },
+	{ "Equal;", "\342\251\265" },
+	{ "YAcy;", "\320\257" },
+	{ "Implies;", "\342\207\222" },
+	{ "spadesuit;", "\342\231\240" },
+	{ "lE;", "\342\211\246" },
+	{ "laquo", "\302\253" },
+	{ "quatint;", "\342\250\226" },
+	{ "zwj;", "\342\200\215" },
+	{ "Aogon;", "\304\204" },
+	{ "circledS;", "\342\223\210" },
+	{ "NotEqual;", "\342\211\240" },
+	{ "imagpart;", "\342\204\221" },
+	{ "Lopf;", "\360\235\225\203" },
+	{ "NegativeThinSpace;", "\342\200\213" },
+	{ "copf;", "\360\235\225\224" },
+	{ "gnE;", "\342\211\251" },
+	{ "leftharpoondown;", "\342\206\275" },
+	{ "nleqq;", "\342\211\246\314\270" },
+	{ "hercon;", "\342\212\271" },
+	{ "Idot;", "\304\260" },
+	{ "dstrok;", "\304\221" },
+	{ "Tab;", "\011" },
+	{ "ohm;", "\316\251" },
+	{ "nvle;", "\342\211\244\342\203\222" },
+	{ "UnderParenthesis;", "\342\217\235" },
+	{ "lnsim;", "\342\213\246" },
+	{ "oror;", "\342\251\226" },
+	{ "SubsetEqual;", "\342\212\206" },
+	{ "aacute", "\303\241" },
+	{ "submult;", "\342\253\201" },
+	{ "Phi;", "\316\246" },
+	{ "looparrowleft;", "\342\206\253" },
+	{ "Longleftrightarrow;", "\342\237\272" },
+	{ "ouml", "\303\266" },
+	{ "lmidot;", "\305\200" },
+	{ "nsucceq;", "\342\252\260\314\270" },
+	{ "KJcy;", "\320\214" },
+	{ "VerticalLine;", "|" },
+	{ "LessLess;", "\342\252\241" },
+	{ "nrarr;", "\342\206\233" },
+	{ "Upsi;", "\317\222" },
+	{ "andv;", "\342\251\232" },
+	{ "Bfr;", "\360\235\224\205" },
+	{ "dagger;", "\342\200\240" },
+	{ "scE;", "\342\252\264" },
+	{ "nmid;", "\342\210\244" },
+	{ "Rang;", "\342\237\253" },
+	{ "lfisht;", "\342\245\274" },
+	{ "gtcc;", "\342\252\247" },
+	{ "topf;", "\360\235\225\245" },
+	{ "Euml", "\303\213" },
+	{ "Tcedil;", "\305\242" },
+	{ "Auml;", "\303\204" },
+	{ "blacksquare;", "\342\226\252" },
+	{ "wreath;", "\342\211\200" },
+	{ "sup2;", "\302\262" },
+	{ "Wfr;", "\360\235\224\232" },
+	{ "ContourIntegral;", "\342\210\256" },
+	{ "incare;", "\342\204\205" },
+	{ "esdot;", "\342\211\220" },
+	{ "and;", "\342\210\247" },
+	{ "Ncy;", "\320\235" },
+	{ "boxv;", "\342\224\202" },
+	{ "NotSubsetEqual;", "\342\212\210" },
+	{ "nvltrie;", "\342\212\264\342\203\222" },
+	{ "xotime;", "\342\250\202" },
+	{ "Rrightarrow;", "\342\207\233" },
+	{ "ocy;", "\320\276" },
+	{ "bscr;", "\360\235\222\267" },
+	{ "REG;", "\302\256" },
+	{ "check;", "\342\234\223" },
+	{ "ntilde;", "\303\261" },
+	{ "nless;", "\342\211\256" },
+	{ "lharul;", "\342\245\252" },
+	{ "nlt;", "\342\211\256" },
+	{ "colone;", "\342\211\224" },
+	{ "trade;", "\342\204\242" },
+	{ "bepsi;", "\317\266" },
+	{ "dharr;", "\342\207\202" },
+	{ "Barwed;", "\342\214\206" },
+	{ "NotGreaterLess;", "\342\211\271" },
+	{ "divide", "\303\267" },
+	{ "subseteqq;", "\342\253\205" },
+	{ "micro", "\302\265" },
+	{ "UnderBar;", "_" },
+	{ "NestedGreaterGreater;", "\342\211\253" },
+	{ "escr;", "\342\204\257" },
+	{ "centerdot;", "\302\267" },
+	{ "DoubleLongLeftArrow;", "\342\237\270" },
+	{ "llcorner;", "\342\214\236" },
+	{ "ogon;", "\313\233" },
+	{ "ecy;", "\321\215" },
+	{ "uml", "\302\250" },
+	{ "GreaterLess;", "\342\211\267" },
+	{ "VerticalTilde;", "\342\211\200" },
+	{ "imagline;", "\342\204\220" },
+	{ "neArr;", "\342\207\227" },
+	{ "in;", "\342\210\210" },
+	{ "gnsim;", "\342\213\247" },
+	{ "ddarr;", "\342\207\212" },
+	{ "supseteqq;", "\342\253\206" },
+	{ "Rcedil;", "\305\226" },
+	{ "scy;", "\321\201" },
+	{ "Gdot;", "\304\240" },
+	{ "pscr;", "\360\235\223\205" },
+	{ "mnplus;", "\342\210\223" },
+	{ "ncaron;", "\305\210" },
+	{ "boxUR;", "\342\225\232" },
+	{ "hookleftarrow;", "\342\206\251" },
+	{ "sup;", "\342\212\203" },
+	{ "rfisht;", "\342\245\275" },
+	{ "Ffr;", "\360\235\224\211" },
+	{ "ge;", "\342\211\245" },
+	{ "capdot;", "\342\251\200" },
+	{ "xcap;", "\342\213\202" },
+	{ "Therefore;", "\342\210\264" },
+	{ "ltrif;", "\342\227\202" },
+	{ "lsim;", "\342\211\262" },
+	{ "RightUpVector;", "\342\206\276" },
+	{ "DoubleUpArrow;", "\342\207\221" },
+	{ "dlcorn;", "\342\214\236" },
+	{ "oS;", "\342\223\210" },
+	{ "squ;", "\342\226\241" },
+	{ "nexists;", "\342\210\204" },
+	{ "aacute;", "\303\241" },
+	{ "yacy;", "\321\217" },
+	{ "GreaterGreater;", "\342\252\242" },
+	{ "nsupset;", "\342\212\203\342\203\222" },
+	{ "succapprox;", "\342\252\270" },
+	{ "LeftTriangleBar;", "\342\247\217" },
+	{ "LongRightArrow;", "\342\237\266" },
+	{ "rthree;", "\342\213\214" },
+	{ "pertenk;", "\342\200\261" },
+	{ "Larr;", "\342\206\236" },
+	{ "NotLeftTriangleBar;", "\342\247\217\314\270" },
+	{ "Ouml;", "\303\226" },
+	{ "clubs;", "\342\231\243" },
+	{ "squf;", "\342\226\252" },
+	{ "supE;", "\342\253\206" },
+	{ "rlarr;", "\342\207\204" },
+	{ "ang;", "\342\210\240" },
+	{ "LessSlantEqual;", "\342\251\275" },
+	{ "circleddash;", "\342\212\235" },
+	{ "Otilde", "\303\225" },
+	{ "realine;", "\342\204\233" },
+	{ "ulcorn;", "\342\214\234" },
+	{ "plusdu;", "\342\250\245" },
+	{ "race;", "\342\210\275\314\261" },
+	{ "GreaterFullEqual;", "\342\211\247" },
+	{ "Nu;", "\316\235" },
+	{ "bottom;", "\342\212\245" },
+	{ "egrave", "\303\250" },
+	{ "tosa;", "\342\244\251" },
+	{ "dzigrarr;", "\342\237\277" },
+	{ "xopf;", "\360\235\225\251" },
+	{ "Wopf;", "\360\235\225\216" },
+	{ "nLeftrightarrow;", "\342\207\216" },
+	{ "Eacute", "\303\211" },
+	{ "Lcedil;", "\304\273" },
+	{ "eDot;", "\342\211\221" },
+	{ "GreaterTilde;", "\342\211\263" },
+	{ "orv;", "\342\251\233" },
+	{ "DoubleUpDownArrow;", "\342\207\225" },
+	{ "les;", "\342\251\275" },
+	{ "kappav;", "\317\260" },
+	{ "ThinSpace;", "\342\200\211" },
+	{ "wp;", "\342\204\230" },
+	{ "boxbox;", "\342\247\211" },
+	{ "thorn;", "\303\276" },
+	{ "RightArrowLeftArrow;", "\342\207\204" },
+	{ "leftrightarrows;", "\342\207\206" },
+	{ "Sigma;", "\316\243" },
+	{ "lacute;", "\304\272" },
+	{ "HilbertSpace;", "\342\204\213" },
+	{ "RightUpVectorBar;", "\342\245\224" },
+	{ "notni;", "\342\210\214" },
+	{ "infintie;", "\342\247\235" },
+	{ "longrightarrow;", "\342\237\266" },
+	{ "ntrianglelefteq;", "\342\213\254" },
+	{ "Lcy;", "\320\233" },
+	{ "rdquo;", "\342\200\235" },
+	{ "ee;", "\342\205\207" },
+	{ "rect;", "\342\226\255" },
+	{ "downharpoonleft;", "\342\207\203" },
+	{ "jsercy;", "\321\230" },
+	{ "NotSucceeds;", "\342\212\201" },
+	{ "vltri;", "\342\212\262" },
+	{ "Uogon;", "\305\262" },
+	{ "intercal;", "\342\212\272" },
+	{ "subrarr;", "\342\245\271" },
+	{ "sccue;", "\342\211\275" },
+	{ "Ucy;", "\320\243" },
+	{ "Tfr;", "\360\235\224\227" },
+	{ "leftharpoonup;", "\342\206\274" },
+	{ "varsigma;", "\317\202" },
+	{ "primes;", "\342\204\231" },
+	{ "Chi;", "\316\247" },
+	{ "blacktriangle;", "\342\226\264" },
+	{ "olarr;", "\342\206\272" },
+	{ "mu;", "\316\274" },
+	{ "gneqq;", "\342\211\251" },
+	{ "gcirc;", "\304\235" },
+	{ "Rsh;", "\342\206\261" },
+	{ "upsih;", "\317\222" },
+	{ "circledcirc;", "\342\212\232" },
+	{ "uhblk;", "\342\226\200" },
+	{ "nacute;", "\305\204" },
+	{ "Rho;", "\316\241" },
+	{ "DScy;", "\320\205" },
+	{ "veebar;", "\342\212\273" },
+	{ "zcy;", "\320\267" },
+	{ "racute;", "\305\225" },
+	{ "NotHumpDownHump;", "\342\211\216\314\270" },
+	{ "Gcedil;", "\304\242" },
+	{ "NotCupCap;", "\342\211\255" },
+	{ "nbump;", "\342\211\216\314\270" },
+	{ "gammad;", "\317\235" },
+	{ "inodot;", "\304\261" },
+	{ "colon;", ":" },
+	{ "Upsilon;", "\316\245" },
+	{ "nlarr;", "\342\206\232" },
+	{ "VeryThinSpace;", "\342\200\212" },
+	{ "dtri;", "\342\226\277" },
+	{ "Hacek;", "\313\207" },
+	{ "flat;", "\342\231\255" },
+	{ "napprox;", "\342\211\211" },
+	{ "bbrk;", "\342\216\265" },
+	{ "iuml", "\303\257" },
+	{ "UnderBracket;", "\342\216\265" },
+	{ "gtrless;", "\342\211\267" },
+	{ "Scirc;", "\305\234" },
+	{ "Itilde;", "\304\250" },
+	{ "kfr;", "\360\235\224\250" },
+	{ "Efr;", "\360\235\224\210" },
+	{ "laquo;", "\302\253" },
+	{ "suphsub;", "\342\253\227" },
+	{ "csube;", "\342\253\221" },
+	{ "eogon;", "\304\231" },
+	{ "ShortDownArrow;", "\342\206\223" },
+	{ "lt", "<" },
+	{ "phone;", "\342\230\216" },
+	{ "capcap;", "\342\251\213" },
+	{ "subnE;", "\342\253\213" },
+	{ "equals;", "=" },
+	{ "sqsub;", "\342\212\217" },
+	{ "acirc", "\303\242" },
+	{ "sup3", "\302\263" },
+	{ "bot;", "\342\212\245" },
+	{ "NotSupersetEqual;", "\342\212\211" },
+	{ "DoubleRightArrow;", "\342\207\222" },
+	{ "sup2", "\302\262" },
+	{ "vellip;", "\342\213\256" },
+	{ "aogon;", "\304\205" },
+	{ "frac12;", "\302\275" },
+	{ "IJlig;", "\304\262" },
+	{ "tritime;", "\342\250\273" },
+	{ "Aacute", "\303\201" },
+	{ "parallel;", "\342\210\245" },
+	{ "boxdR;", "\342\225\222" },
+	{ "dotminus;", "\342\210\270" },
+	{ "varkappa;", "\317\260" },
+	{ "Breve;", "\313\230" },
+	{ "Omacr;", "\305\214" },
+	{ "lopf;", "\360\235\225\235" },
+	{ "tint;", "\342\210\255" },
+	{ "eDDot;", "\342\251\267" },
+	{ "backepsilon;", "\317\266" },
+	{ "Cap;", "\342\213\222" },
+	{ "ZHcy;", "\320\226" },
+	{ "Sc;", "\342\252\274" },
+	{ "ulcrop;", "\342\214\217" },
+	{ "oelig;", "\305\223" },
+	{ "rsquor;", "\342\200\231" },
+	{ "uHar;", "\342\245\243" },
+	{ "boxvR;", "\342\225\236" },
+	{ "geqq;", "\342\211\247" },
+	{ "nearr;", "\342\206\227" },
+	{ "boxur;", "\342\224\224" },
+	{ "DownTee;", "\342\212\244" },
+	{ "boxUl;", "\342\225\234" },
+	{ "bullet;", "\342\200\242" },
+	{ "icirc", "\303\256" },
+	{ "epsiv;", "\317\265" },
+	{ "malt;", "\342\234\240" },
+	{ "nGtv;", "\342\211\253\314\270" },
+	{ "leftarrowtail;", "\342\206\242" },
+	{ "nedot;", "\342\211\220\314\270" },
+	{ "frac14", "\302\274" },
+	{ "bigcup;", "\342\213\203" },
+	{ "parsim;", "\342\253\263" },
+	{ "Aopf;", "\360\235\224\270" },
+	{ "nfr;", "\360\235\224\253" },
+	{ "qscr;", "\360\235\223\206" },
+	{ "ubreve;", "\305\255" },
+	{ "Escr;", "\342\204\260" },
+	{ "oacute", "\303\263" },
+	{ "Sup;", "\342\213\221" },
+	{ "RightUpDownVector;", "\342\245\217" },
+	{ "piv;", "\317\226" },
+	{ "macr;", "\302\257" },
+	{ "nopf;", "\360\235\225\237" },
+	{ "DiacriticalGrave;", "`" },
+	{ "lceil;", "\342\214\210" },
+	{ "times", "\303\227" },
+	{ "lne;", "\342\252\207" },
+	{ "frac23;", "\342\205\224" },
+	{ "uarr;", "\342\206\221" },
+	{ "Element;", "\342\210\210" },
+	{ "kscr;", "\360\235\223\200" },
+	{ "cylcty;", "\342\214\255" },
+	{ "eth;", "\303\260" },
+	{ "NotRightTriangleBar;", "\342\247\220\314\270" },
+	{ "Dcy;", "\320\224" },
+	{ "Icy;", "\320\230" },
+	{ "leqslant;", "\342\251\275" },
+	{ "apacir;", "\342\251\257" },
+	{ "LessEqualGreater;", "\342\213\232" },
+	{ "Rarr;", "\342\206\240" },
+	{ "nwarr;", "\342\206\226" },
+	{ "isinE;", "\342\213\271" },
+	{ "rarrb;", "\342\207\245" },
+	{ "ngt;", "\342\211\257" },
+	{ "gtdot;", "\342\213\227" },
+	{ "Im;", "\342\204\221" },
+	{ "tprime;", "\342\200\264" },
+	{ "ncedil;", "\305\206" },
+	{ "zhcy;", "\320\266" },
+	{ "edot;", "\304\227" },
+	{ "euro;", "\342\202\254" },
+	{ "kopf;", "\360\235\225\234" },
+	{ "notinvb;", "\342\213\267" },
+	{ "approxeq;", "\342\211\212" },
+	{ "rtimes;", "\342\213\212" },
+	{ "angmsdae;", "\342\246\254" },
+	{ "LeftDownVector;", "\342\207\203" },
+	{ "bnot;", "\342\214\220" },
+	{ "minusd;", "\342\210\270" },
+	{ "isinv;", "\342\210\210" },
+	{ "llhard;", "\342\245\253" },
+	{ "Euml;", "\303\213" },
+	{ "ordm", "\302\272" },
+	{ "TripleDot;", "\342\203\233" },
+	{ "lAtail;", "\342\244\233" },
+	{ "Ncedil;", "\305\205" },
+	{ "Hat;", "^" },
+	{ "Ncaron;", "\305\207" },
+	{ "bigodot;", "\342\250\200" },
+	{ "imath;", "\304\261" },
+	{ "plusacir;", "\342\250\243" },
+	{ "bNot;", "\342\253\255" },
+	{ "nsup;", "\342\212\205" },
+	{ "searhk;", "\342\244\245" },
+	{ "rarrc;", "\342\244\263" },
+	{ "npre;", "\342\252\257\314\270" },
+	{ "bsolb;", "\342\247\205" },
+	{ "supsup;", "\342\253\226" },
+	{ "diamondsuit;", "\342\231\246" },
+	{ "GT;", ">" },
+	{ "acute;", "\302\264" },
+	{ "Tcaron;", "\305\244" },
+	{ "naturals;", "\342\204\225" },
+	{ "hairsp;", "\342\200\212" },
+	{ "Iuml;", "\303\217" },
+	{ "otilde;", "\303\265" },
+	{ "Iacute", "\303\215" },
+	{ "hellip;", "\342\200\246" },
+	{ "Ntilde", "\303\221" },
+	{ "iacute", "\303\255" },
+	{ "QUOT;", "\042" },
+	{ "CenterDot;", "\302\267" },
+	{ "DoubleLeftArrow;", "\342\207\220" },
+	{ "frac38;", "\342\205\234" },
+	{ "Uarrocir;", "\342\245\211" },
+	{ "strns;", "\302\257" },
+	{ "NotLeftTriangle;", "\342\213\252" },
+	{ "Iuml", "\303\217" },
+	{ "rlhar;", "\342\207\214" },
+	{ "Pscr;", "\360\235\222\253" },
+	{ "zdot;", "\305\274" },
+	{ "ograve;", "\303\262" },
+	{ "agrave;", "\303\240" },
+	{ "gnap;", "\342\252\212" },
+	{ "Udblac;", "\305\260" },
+	{ "rcub;", "}" },
+	{ "shortmid;", "\342\210\243" },
+	{ "xnis;", "\342\213\273" },
+	{ "squarf;", "\342\226\252" },
+	{ "dotplus;", "\342\210\224" },
+	{ "ordf;", "\302\252" },
+	{ "rArr;", "\342\207\222" },
+	{ "olcross;", "\342\246\273" },
+	{ "blacklozenge;", "\342\247\253" },
+	{ "gopf;", "\360\235\225\230" },
+	{ "rdquor;", "\342\200\235" },
+	{ "Zcaron;", "\305\275" },
+	{ "cuesc;", "\342\213\237" },
+	{ "efr;", "\360\235\224\242" },
+	{ "lessapprox;", "\342\252\205" },
+	{ "nrtri;", "\342\213\253" },
+	{ "Gopf;", "\360\235\224\276" },
+	{ "ccaps;", "\342\251\215" },
+	{ "beth;", "\342\204\266" },
+	{ "Ograve", "\303\222" },
+	{ "LowerLeftArrow;", "\342\206\231" },
+	{ "Vfr;", "\360\235\224\231" },
+	{ "curlywedge;", "\342\213\217" },
+	{ "divide;", "\303\267" },
+	{ "apE;", "\342\251\260" },
+	{ "ast;", "*" },
+	{ "downharpoonright;", "\342\207\202" },
+	{ "times;", "\303\227" },
+	{ "LeftUpTeeVector;", "\342\245\240" },
+	{ "ocirc;", "\303\264" },
+	{ "cross;", "\342\234\227" },
+	{ "Gbreve;", "\304\236" },
+	{ "bkarow;", "\342\244\215" },
+	{ "scnE;", "\342\252\266" },
+	{ "succnsim;", "\342\213\251" },
+	{ "nsube;", "\342\212\210" },
+	{ "simlE;", "\342\252\237" },
+	{ "Rarrtl;", "\342\244\226" },
+	{ "NotSucceedsSlantEqual;", "\342\213\241" },
+	{ "isinsv;", "\342\213\263" },
+	{ "nsce;", "\342\252\260\314\270" },
+	{ "nshortparallel;", "\342\210\246" },
+	{ "circledR;", "\302\256" },
+	{ "OverBracket;", "\342\216\264" },
+	{ "sqsupseteq;", "\342\212\222" },
+	{ "cap;", "\342\210\251" },
+	{ "RightUpTeeVector;", "\342\245\234" },
+	{ "pre;", "\342\252\257" },
+	{ "COPY;", "\302\251" },
+	{ "boxhD;", "\342\225\245" },
+	{ "fpartint;", "\342\250\215" },
+	{ "hkswarow;", "\342\244\246" },
+	{ "Xopf;", "\360\235\225\217" },
+	{ "Xi;", "\316\236" },
+	{ "Copf;", "\342\204\202" },
+	{ "gdot;", "\304\241" },
+	{ "rrarr;", "\342\207\211" },
+	{ "varnothing;", "\342\210\205" },
+	{ "DownArrowUpArrow;", "\342\207\265" },
+	{ "Tilde;", "\342\210\274" },
+	{ "ii;", "\342\205\210" },
+	{ "rdca;", "\342\244\267" },
+	{ "angrtvbd;", "\342\246\235" },
+	{ "Star;", "\342\213\206" },
+	{ "euml", "\303\253" },
+	{ "iquest;", "\302\277" },
+	{ "igrave;", "\303\254" },
+	{ "nlE;", "\342\211\246\314\270" },
+	{ "uopf;", "\360\235\225\246" },
+	{ "ncong;", "\342\211\207" },
+	{ "bigsqcup;", "\342\250\206" },
+	{ "rangd;", "\342\246\222" },
+	{ "dd;", "\342\205\206" },
+	{ "supset;", "\342\212\203" },
+	{ "grave;", "`" },
+	{ "NotSubset;", "\342\212\202\342\203\222" },
+	{ "angmsdaf;", "\342\246\255" },
+	{ "rcy;", "\321\200" },
+	{ "Ugrave;", "\303\231" },
+	{ "plankv;", "\342\204\217" },
+	{ "hArr;", "\342\207\224" },
+	{ "utri;", "\342\226\265" },
+	{ "nparsl;", "\342\253\275\342\203\245" },
+	{ "boxVh;", "\342\225\253" },
+	{ "lrhar;", "\342\207\213" },
+	{ "sopf;", "\360\235\225\244" },
+	{ "osol;", "\342\212\230" },
+	{ "cudarrl;", "\342\244\270" },
+	{ "twixt;", "\342\211\254" },
+	{ "oplus;", "\342\212\225" },
+	{ "lEg;", "\342\252\213" },
+	{ "fcy;", "\321\204" },
+	{ "boxdL;", "\342\225\225" },
+	{ "rhov;", "\317\261" },
+	{ "Nfr;", "\360\235\224\221" },
+	{ "RightVectorBar;", "\342\245\223" },
+	{ "lcedil;", "\304\274" },
+	{ "hcirc;", "\304\245" },
+	{ "GT", ">" },
+	{ "Ntilde;", "\303\221" },
+	{ "deg;", "\302\260" },
+	{ "kcy;", "\320\272" },
+	{ "prurel;", "\342\212\260" },
+	{ "equivDD;", "\342\251\270" },
+	{ "lcub;", "{" },
+	{ "boxUr;", "\342\225\231" },
+	{ "NotSquareSubset;", "\342\212\217\314\270" },
+	{ "urcorn;", "\342\214\235" },
+	{ "swarrow;", "\342\206\231" },
+	{ "telrec;", "\342\214\225" },
+	{ "lesges;", "\342\252\223" },
+	{ "Uring;", "\305\256" },
+	{ "gnapprox;", "\342\252\212" },
+	{ "gtrsim;", "\342\211\263" },
+	{ "zeta;", "\316\266" },
+	{ "xi;", "\316\276" },
+	{ "Darr;", "\342\206\241" },
+	{ "Bscr;", "\342\204\254" },
+	{ "succ;", "\342\211\273" },
+	{ "leftthreetimes;", "\342\213\213" },
+	{ "boxhu;", "\342\224\264" },
+	{ "nrtrie;", "\342\213\255" },
+	{ "doublebarwedge;", "\342\214\206" },
+	{ "curlyvee;", "\342\213\216" },
+	{ "homtht;", "\342\210\273" },
+	{ "alpha;", "\316\261" },
+	{ "AElig", "\303\206" },
+	{ "natural;", "\342\231\256" },
+	{ "fallingdotseq;", "\342\211\222" },
+	{ "boxhd;", "\342\224\254" },
+	{ "ell;", "\342\204\223" },
+	{ "xodot;", "\342\250\200" },
+	{ "Gamma;", "\316\223" },
+	{ "DoubleLongLeftRightArrow;", "\342\237\272" },
+	{ "simg;", "\342\252\236" },
+	{ "rcedil;", "\305\227" },
+	{ "lBarr;", "\342\244\216" },
+	{ "checkmark;", "\342\234\223" },
+	{ "Yfr;", "\360\235\224\234" },
+	{ "boxh;", "\342\224\200" },
+	{ "rpar;", ")" },
+	{ "sup3;", "\302\263" },
+	{ "cemptyv;", "\342\246\262" },
+	{ "csup;", "\342\253\220" },
+	{ "complexes;", "\342\204\202" },
+	{ "leftrightsquigarrow;", "\342\206\255" },
+	{ "ultri;", "\342\227\270" },
+	{ "UpArrowBar;", "\342\244\222" },
+	{ "rangle;", "\342\237\251" },
+	{ "planck;", "\342\204\217" },
+	{ "cupbrcap;", "\342\251\210" },
+	{ "YUcy;", "\320\256" },
+	{ "iexcl;", "\302\241" },
+	{ "ensp;", "\342\200\202" },
+	{ "triangle;", "\342\226\265" },
+	{ "cwint;", "\342\210\261" },
+	{ "ubrcy;", "\321\236" },
+	{ "npr;", "\342\212\200" },
+	{ "lessgtr;", "\342\211\266" },
+	{ "nap;", "\342\211\211" },
+	{ "elinters;", "\342\217\247" },
+	{ "shchcy;", "\321\211" },
+	{ "kappa;", "\316\272" },
+	{ "smashp;", "\342\250\263" },
+	{ "olcir;", "\342\246\276" },
+	{ "nles;", "\342\251\275\314\270" },
+	{ "robrk;", "\342\237\247" },
+	{ "diam;", "\342\213\204" },
+	{ "euml;", "\303\253" },
+	{ "iff;", "\342\207\224" },
+	{ "RightDownVector;", "\342\207\202" },
+	{ "Omicron;", "\316\237" },
+	{ "minusdu;", "\342\250\252" },
+	{ "ndash;", "\342\200\223" },
+	{ "iprod;", "\342\250\274" },
+	{ "sect;", "\302\247" },
+	{ "nwnear;", "\342\244\247" },
+	{ "xscr;", "\360\235\223\215" },
+	{ "uplus;", "\342\212\216" },
+	{ "Iopf;", "\360\235\225\200" },
+	{ "maltese;", "\342\234\240" },
+	{ "wedgeq;", "\342\211\231" },
+	{ "ldrushar;", "\342\245\213" },
+	{ "Mu;", "\316\234" },
+	{ "leg;", "\342\213\232" },
+	{ "Gt;", "\342\211\253" },
+	{ "rscr;", "\360\235\223\207" },
+	{ "nLl;", "\342\213\230\314\270" },
+	{ "YIcy;", "\320\207" },
+	{ "congdot;", "\342\251\255" },
+	{ "subsup;", "\342\253\223" },
+	{ "TRADE;", "\342\204\242" },
+	{ "sacute;", "\305\233" },
+	{ "larrfs;", "\342\244\235" },
+	{ "demptyv;", "\342\246\261" },
+	{ "angrt;", "\342\210\237" },
+	{ "le;", "\342\211\244" },
+	{ "fork;", "\342\213\224" },
+	{ "thkap;", "\342\211\210" },
+	{ "udarr;", "\342\207\205" },
+	{ "plussim;", "\342\250\246" },
+	{ "hardcy;", "\321\212" },
+	{ "ucy;", "\321\203" },
+	{ "solbar;", "\342\214\277" },
+	{ "boxvH;", "\342\225\252" },
+	{ "nvDash;", "\342\212\255" },
+	{ "sect", "\302\247" },
+	{ "NotSquareSuperset;", "\342\212\220\314\270" },
+	{ "nsub;", "\342\212\204" },
+	{ "LessTilde;", "\342\211\262" },
+	{ "ncy;", "\320\275" },
+	{ "angmsdab;", "\342\246\251" },
+	{ "Lscr;", "\342\204\222" },
+	{ "CHcy;", "\320\247" },
+	{ "upharpoonright;", "\342\206\276" },
+	{ "ngeq;", "\342\211\261" },
+	{ "uml;", "\302\250" },
+	{ "multimap;", "\342\212\270" },
+	{ "backsim;", "\342\210\275" },
+	{ "Because;", "\342\210\265" },
+	{ "rharul;", "\342\245\254" },
+	{ "oopf;", "\360\235\225\240" },
+	{ "andand;", "\342\251\225" },
+	{ "Yscr;", "\360\235\222\264" },
+	{ "utdot;", "\342\213\260" },
+	{ "rightthreetimes;", "\342\213\214" },
+	{ "nparallel;", "\342\210\246" },
+	{ "Uparrow;", "\342\207\221" },
+	{ "bumpe;", "\342\211\217" },
+	{ "curlyeqprec;", "\342\213\236" },
+	{ "OElig;", "\305\222" },
+	{ "nwarrow;", "\342\206\226" },
+	{ "lHar;", "\342\245\242" },
+	{ "tridot;", "\342\227\254" },
+	{ "csub;", "\342\253\217" },
+	{ "lsime;", "\342\252\215" },
+	{ "commat;", "@" },
+	{ "jfr;", "\360\235\224\247" },
+	{ "RightTriangle;", "\342\212\263" },
+	{ "orderof;", "\342\204\264" },
+	{ "rang;", "\342\237\251" },
+	{ "hksearow;", "\342\244\245" },
+};
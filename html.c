@@ -0,0 +1,401 @@
+#include <stdlib.h>
+#include <string.h>
+#include "html.h"
+#include "entities.h"
+
+// mkentities.pyのfnvと同じもの
+static uint32_t entity_hash(const char *s, size_t len, uint32_t seed)
+{
+	uint32_t h = 2166136261u ^ seed;
+	for(size_t i = 0; i < len; i++) {
+		h ^= (unsigned char)s[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+int nano_html_entity(const char *name, size_t len, char *out)
+{
+	const struct entity *e;
+	size_t n;
+
+	if(len == 0 || len > NANO_ENTITY_NAME_MAX) return 0;
+	e = &entities[entity_hash(name, len, entity_disp[entity_hash(name, len, 0) % NANO_ENTITY_BUCKETS]) % NANO_ENTITY_COUNT];
+	if(strncmp(e->name, name, len) != 0 || e->name[len] != '\0') return 0;
+	n = strlen(e->value);
+	memcpy(out, e->value, n);
+	return (int)n;
+}
+
+// 数値文字参照の0x80〜0x9FはWindows-1252として読む(HTML5の決まり)
+static const uint16_t cp1252[32] = {
+	0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+	0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+static int utf8_encode(uint32_t c, char *out)
+{
+	if(c < 0x80) {
+		out[0] = (char)c;
+		return 1;
+	} else if(c < 0x800) {
+		out[0] = (char)(0xc0 | (c >> 6));
+		out[1] = (char)(0x80 | (c & 0x3f));
+		return 2;
+	} else if(c < 0x10000) {
+		out[0] = (char)(0xe0 | (c >> 12));
+		out[1] = (char)(0x80 | ((c >> 6) & 0x3f));
+		out[2] = (char)(0x80 | (c & 0x3f));
+		return 3;
+	}
+	out[0] = (char)(0xf0 | (c >> 18));
+	out[1] = (char)(0x80 | ((c >> 12) & 0x3f));
+	out[2] = (char)(0x80 | ((c >> 6) & 0x3f));
+	out[3] = (char)(0x80 | (c & 0x3f));
+	return 4;
+}
+
+// 変換中の文字列と種類の一続きは手元のバッファに溜め,最後に1回だけ確保して移す
+// (ほとんどのTootはこれに収まる,収まらなければヒープに移して伸ばす)
+#define TEXT_LOCAL 4096
+#define SPANS_LOCAL 128
+
+struct builder {
+	char *text;
+	size_t len, text_cap;
+	struct nano_html_span *spans;
+	size_t nspans, spans_cap;
+	enum nano_html_style style;
+	int hidden;		// class="invisible"の中
+	char text_local[TEXT_LOCAL];
+	struct nano_html_span spans_local[SPANS_LOCAL];
+};
+
+// *pをcount個入るようにする,localを指している間は新しく確保して中身を移す
+static int grow(void **p, size_t *cap, size_t count, size_t size, void *local)
+{
+	size_t n;
+	void *q;
+
+	if(count <= *cap) return 1;
+	n = *cap;
+	while(n < count) n *= 2;
+	if(*p == local) {
+		q = malloc(n * size);
+		if(q) memcpy(q, *p, *cap * size);
+	} else {
+		q = realloc(*p, n * size);
+	}
+	if(!q) return 0;
+	*p = q;
+	*cap = n;
+	return 1;
+}
+
+// 今の種類で文字列を足す
+static void put(struct builder *b, const char *s, size_t n)
+{
+	struct nano_html_span *sp;
+
+	if(n == 0 || b->hidden) return;
+	if(!grow((void **)&b->text, &b->text_cap, b->len + n, 1, b->text_local)) return;
+	memcpy(b->text + b->len, s, n);
+
+	sp = b->nspans ? &b->spans[b->nspans - 1] : NULL;
+	if(sp && sp->style == b->style) {
+		sp->len += (uint32_t)n;
+	} else if(grow((void **)&b->spans, &b->spans_cap, b->nspans + 1, sizeof(struct nano_html_span), b->spans_local)) {
+		sp = &b->spans[b->nspans++];
+		sp->off = (uint32_t)b->len;
+		sp->len = (uint32_t)n;
+		sp->style = b->style;
+	}
+	b->len += n;
+}
+
+// spansとtextを後ろに続けて1つに確保する
+static struct nano_html *html_alloc(size_t len, size_t nspans)
+{
+	size_t spans_size = sizeof(struct nano_html_span) * nspans;
+	struct nano_html *h = malloc(sizeof(struct nano_html) + spans_size + len + 1);
+
+	if(!h) return NULL;
+	h->spans = (struct nano_html_span *)(h + 1);
+	h->text = (char *)h->spans + spans_size;
+	h->len = len;
+	h->nspans = nspans;
+	return h;
+}
+
+static int is_alpha(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static int is_alnum(char c)
+{
+	return is_alpha(c) || (c >= '0' && c <= '9');
+}
+
+static int is_space(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static int hex_value(char c)
+{
+	if(c >= '0' && c <= '9') return c - '0';
+	if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+// pの'&'から文字参照を読んでoutに値を書く,読んだバイト数を返す(文字参照でなければ0)
+static size_t char_ref(const char *p, const char *end, char *out, int *outlen)
+{
+	const char *q = p + 1;
+
+	if(q < end && *q == '#') {
+		uint32_t c = 0;
+		int hex = 0, digits = 0, d;
+
+		q++;
+		if(q < end && (*q == 'x' || *q == 'X')) {
+			hex = 1;
+			q++;
+		}
+		for(; q < end && (d = hex ? hex_value(*q) : (*q >= '0' && *q <= '9' ? *q - '0' : -1)) >= 0; q++, digits++) {
+			if(c <= 0x10FFFF) c = c * (hex ? 16 : 10) + d;
+		}
+		if(digits == 0) return 0;
+		if(q < end && *q == ';') q++;
+
+		if(c == 0 || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) c = 0xFFFD;
+		else if(c >= 0x80 && c <= 0x9F) c = cp1252[c - 0x80];
+		*outlen = utf8_encode(c, out);
+		return q - p;
+	}
+
+	// 名前は;まで,;が無ければ古い書き方として長いものから試す
+	size_t n = 0;
+	while(q + n < end && n <= NANO_ENTITY_NAME_MAX && is_alnum(q[n])) n++;
+	if(n == 0) return 0;
+	if(q + n < end && q[n] == ';' && (*outlen = nano_html_entity(q, n + 1, out)) > 0) return n + 2;
+	for(size_t k = n < 6 ? n : 6; k >= 2; k--) {
+		if((*outlen = nano_html_entity(q, k, out)) > 0) return k + 1;
+	}
+	return 0;
+}
+
+// 空白区切りのclass属性にnameがあるか
+static int has_class(const char *cls, size_t len, const char *name)
+{
+	size_t n = strlen(name);
+	const char *end = cls + len;
+
+	while(cls < end) {
+		const char *w = cls;
+		while(cls < end && !is_space(*cls)) cls++;
+		if((size_t)(cls - w) == n && memcmp(w, name, n) == 0) return 1;
+		while(cls < end && is_space(*cls)) cls++;
+	}
+	return 0;
+}
+
+static int tag_is(const char *name, size_t len, const char *tag)
+{
+	size_t n = strlen(tag);
+	if(len != n) return 0;
+	for(size_t i = 0; i < n; i++) {
+		if((name[i] | 0x20) != tag[i]) return 0;
+	}
+	return 1;
+}
+
+#define SPAN_DEPTH_MAX 32
+
+enum span_kind {
+	SPAN_PLAIN,
+	SPAN_INVISIBLE,
+	SPAN_ELLIPSIS,
+};
+
+struct nano_html *nano_html_parse(const char *src, size_t len)
+{
+	const char *p = src, *end = src + len;
+	struct nano_html *h;
+	struct builder b;
+	unsigned char spans[SPAN_DEPTH_MAX];
+	int depth = 0, pcount = 0;
+
+	b.text = b.text_local;
+	b.len = 0;
+	b.text_cap = TEXT_LOCAL;
+	b.spans = b.spans_local;
+	b.nspans = 0;
+	b.spans_cap = SPANS_LOCAL;
+	b.style = NANO_HTML_TEXT;
+	b.hidden = 0;
+
+	while(p < end) {
+		const char *t = p;
+
+		// 地の文はタグか文字参照までまとめて(memchrで次の'<'を探し,その手前の'&'を探す)
+		t = memchr(p, '<', end - p);
+		if(!t) t = end;
+		{
+			const char *amp = memchr(p, '&', t - p);
+			if(amp) t = amp;
+		}
+		put(&b, p, t - p);
+		p = t;
+		if(p >= end) break;
+
+		if(*p == '&') {
+			char value[8];
+			int n;
+			size_t used = char_ref(p, end, value, &n);
+			if(used) {
+				put(&b, value, n);
+				p += used;
+			} else {
+				put(&b, p, 1);
+				p++;
+			}
+			continue;
+		}
+
+		// ここからタグ
+		const char *q = p + 1, *name, *cls = NULL;
+		size_t name_len, cls_len = 0;
+		int closing = 0;
+
+		if(q < end && *q == '!') {
+			// コメントなど
+			const char *e = NULL;
+			if(end - q >= 3 && memcmp(q, "!--", 3) == 0) {
+				for(e = q + 3; e + 3 <= end && memcmp(e, "-->", 3) != 0; e++);
+				e = e + 3 <= end ? e + 2 : end;
+			} else {
+				e = memchr(q, '>', end - q);
+				if(!e) e = end;
+			}
+			p = e < end ? e + 1 : end;
+			continue;
+		}
+		if(q < end && *q == '/') {
+			closing = 1;
+			q++;
+		}
+		if(q >= end || !is_alpha(*q)) {
+			// タグではない'<'
+			put(&b, p, 1);
+			p++;
+			continue;
+		}
+
+		name = q;
+		while(q < end && is_alnum(*q)) q++;
+		name_len = q - name;
+
+		// 属性(classだけ覚える)
+		while(q < end && *q != '>') {
+			const char *an, *av = NULL;
+			size_t an_len, av_len = 0;
+
+			if(is_space(*q) || *q == '/') {
+				q++;
+				continue;
+			}
+			an = q;
+			while(q < end && !is_space(*q) && *q != '=' && *q != '>' && *q != '/') q++;
+			an_len = q - an;
+			if(an_len == 0) {
+				q++;
+				continue;
+			}
+			while(q < end && is_space(*q)) q++;
+			if(q < end && *q == '=') {
+				q++;
+				while(q < end && is_space(*q)) q++;
+				if(q < end && (*q == '"' || *q == '\'')) {
+					char quote = *q++;
+					av = q;
+					while(q < end && *q != quote) q++;
+					av_len = q - av;
+					if(q < end) q++;
+				} else {
+					av = q;
+					while(q < end && !is_space(*q) && *q != '>') q++;
+					av_len = q - av;
+				}
+			}
+			if(av && tag_is(an, an_len, "class")) {
+				cls = av;
+				cls_len = av_len;
+			}
+		}
+		p = q < end ? q + 1 : end;
+
+		if(tag_is(name, name_len, "br")) {
+			put(&b, "\n", 1);
+		} else if(tag_is(name, name_len, "p")) {
+			// 2つめ以降の段落は空行を挟む
+			if(!closing && ++pcount >= 2) put(&b, "\n\n", 2);
+		} else if(tag_is(name, name_len, "a")) {
+			if(closing) {
+				b.style = NANO_HTML_TEXT;
+			} else if(cls && has_class(cls, cls_len, "hashtag")) {
+				b.style = NANO_HTML_HASHTAG;
+			} else if(cls && has_class(cls, cls_len, "mention")) {
+				b.style = NANO_HTML_MENTION;
+			} else {
+				b.style = NANO_HTML_LINK;
+			}
+		} else if(tag_is(name, name_len, "span")) {
+			if(!closing) {
+				enum span_kind k = SPAN_PLAIN;
+				if(cls && has_class(cls, cls_len, "invisible")) k = SPAN_INVISIBLE;
+				else if(cls && has_class(cls, cls_len, "ellipsis")) k = SPAN_ELLIPSIS;
+				if(depth < SPAN_DEPTH_MAX) spans[depth] = (unsigned char)k;
+				depth++;
+				if(k == SPAN_INVISIBLE) b.hidden++;
+			} else if(depth > 0) {
+				depth--;
+				if(depth < SPAN_DEPTH_MAX) {
+					if(spans[depth] == SPAN_INVISIBLE) b.hidden--;
+					else if(spans[depth] == SPAN_ELLIPSIS) put(&b, "\xe2\x80\xa6", 3);
+				}
+			}
+		}
+	}
+
+	h = html_alloc(b.len, b.nspans);
+	if(h) {
+		memcpy(h->spans, b.spans, sizeof(struct nano_html_span) * b.nspans);
+		memcpy(h->text, b.text, b.len);
+		h->text[b.len] = '\0';
+	}
+	if(b.text != b.text_local) free(b.text);
+	if(b.spans != b.spans_local) free(b.spans);
+	return h;
+}
+
+struct nano_html *nano_html_dup(const struct nano_html *h)
+{
+	struct nano_html *d;
+
+	if(!h) return NULL;
+	d = html_alloc(h->len, h->nspans);
+	if(!d) return NULL;
+	memcpy(d->spans, h->spans, sizeof(struct nano_html_span) * h->nspans);
+	memcpy(d->text, h->text, h->len + 1);
+	return d;
+}
+
+void nano_html_free(struct nano_html *h)
+{
+	free(h);
+}
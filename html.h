@@ -0,0 +1,42 @@
+#ifndef NANOTODON_HTML_H
+#define NANOTODON_HTML_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 文字列の種類
+enum nano_html_style {
+	NANO_HTML_TEXT,
+	NANO_HTML_LINK,		// <a href>
+	NANO_HTML_MENTION,	// <a class="mention">(@から始まる)
+	NANO_HTML_HASHTAG,	// <a class="mention hashtag">(#から始まる)
+};
+
+// 同じ種類の文字列の一続き(textの[off, off+len))
+struct nano_html_span {
+	uint32_t off;
+	uint32_t len;
+	enum nano_html_style style;
+};
+
+// Tootの本文(MastodonのHTMLのサブセット)を表示用の文字列にしたもの
+// <br>は改行,2つめ以降の<p>は空行,class="invisible"の<span>は除き,class="ellipsis"の後ろには…を付ける
+// 文字参照はHTML5の名前付きのもの全てと数値のものを展開する
+// textとspansはこの構造体と一緒に1つに確保してある(nano_html_freeでまとめて解放する)
+struct nano_html {
+	char *text;		// UTF-8,終端あり
+	size_t len;
+	struct nano_html_span *spans;
+	size_t nspans;
+};
+
+// srcのlenバイトを1回なめて変換する,失敗したらNULL
+struct nano_html *nano_html_parse(const char *src, size_t len);
+struct nano_html *nano_html_dup(const struct nano_html *h);
+void nano_html_free(struct nano_html *h);
+
+// 文字参照の名前(&の後ろから,;があれば;まで)の値をoutに書いてバイト数を返す,無ければ0
+// outは8バイト以上
+int nano_html_entity(const char *name, size_t len, char *out);
+
+#endif
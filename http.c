@@ -0,0 +1,122 @@
+#include <pthread.h>
+#include <string.h>
+#include "http.h"
+#include "queue.h"
+
+struct nano_http_stats nano_http_stat;
+
+static CURLSH *share;
+static pthread_mutex_t share_locks[CURL_LOCK_DATA_LAST];
+
+// スレッドごとに使い終わったハンドルを1つ残しておく
+// 接続のキャッシュはハンドルが持つので,接続の再利用は同じスレッドの中だけで行われる
+static pthread_key_t pool_key;
+static int pool_key_created = 0;
+
+static int http2_available = 0;
+
+static void share_lock(CURL *hnd, curl_lock_data data, curl_lock_access access, void *user)
+{
+	(void)hnd;
+	(void)access;
+	(void)user;
+	pthread_mutex_lock(&share_locks[data]);
+}
+
+static void share_unlock(CURL *hnd, curl_lock_data data, void *user)
+{
+	(void)hnd;
+	(void)user;
+	pthread_mutex_unlock(&share_locks[data]);
+}
+
+// スレッドが終わるときに残っているハンドルを片付ける
+static void pool_destroy(void *hnd)
+{
+	curl_easy_cleanup(hnd);
+}
+
+int nano_http_init(void)
+{
+	if(curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK) return 0;
+	
+	for(int i = 0; i < CURL_LOCK_DATA_LAST; i++) pthread_mutex_init(&share_locks[i], NULL);
+	if(pthread_key_create(&pool_key, pool_destroy) != 0) return 0;
+	pool_key_created = 1;
+	
+	share = curl_share_init();
+	if(!share) return 0;
+	curl_share_setopt(share, CURLSHOPT_LOCKFUNC, share_lock);
+	curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	// 接続のキャッシュは共有しない(複数のスレッドから同時に使うことをlibcurlは想定していない)
+	
+	curl_version_info_data *info = curl_version_info(CURLVERSION_NOW);
+	http2_available = (info->features & CURL_VERSION_HTTP2) != 0;
+	
+	return 1;
+}
+
+void nano_http_cleanup(void)
+{
+	// 他のスレッドのハンドルはそのスレッドが終わるときに片付けられる
+	if(pool_key_created) {
+		CURL *hnd = pthread_getspecific(pool_key);
+		if(hnd) curl_easy_cleanup(hnd);
+		pthread_setspecific(pool_key, NULL);
+	}
+	
+	if(share) curl_share_cleanup(share);
+	share = NULL;
+	curl_global_cleanup();
+}
+
+CURL *nano_http_acquire(void)
+{
+	CURL *hnd = pool_key_created ? pthread_getspecific(pool_key) : NULL;
+	
+	if(hnd) pthread_setspecific(pool_key, NULL);
+	else hnd = curl_easy_init();
+	if(!hnd) return NULL;
+	
+	// 共有設定はcurl_easy_resetで消えるので毎回設定する
+	if(share) curl_easy_setopt(hnd, CURLOPT_SHARE, share);
+	// 多重化できると分かっているHTTP/2接続があればそちらに載る
+	// (PIPEWAITは付けない,HTTP/1.1のストリーミング接続が空くのを待ち続けてしまう)
+	if(http2_available) curl_easy_setopt(hnd, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+	curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 1L);
+	
+	return hnd;
+}
+
+void nano_http_release(CURL *hnd)
+{
+	if(!hnd) return;
+	
+	// 前のリクエストの設定(ヘッダやPOSTデータへのポインタ)を残さない
+	curl_easy_reset(hnd);
+	
+	// このスレッドに残っていなければ残す(接続はハンドルと一緒に残る)
+	if(pool_key_created && !pthread_getspecific(pool_key) && pthread_setspecific(pool_key, hnd) == 0) return;
+	curl_easy_cleanup(hnd);
+}
+
+CURLcode nano_http_perform(CURL *hnd)
+{
+	uint64_t t = nano_queue_now();
+	CURLcode ret = curl_easy_perform(hnd);
+	uint64_t ns = nano_queue_now() - t;
+	long connects = 0;
+	
+	curl_easy_getinfo(hnd, CURLINFO_NUM_CONNECTS, &connects);
+	
+	atomic_fetch_add(&nano_http_stat.requests, 1);
+	atomic_fetch_add(&nano_http_stat.connects, connects);
+	atomic_fetch_add(&nano_http_stat.total_ns, ns);
+	atomic_store(&nano_http_stat.last_ns, ns);
+	uint64_t max = atomic_load(&nano_http_stat.max_ns);
+	while(ns > max && !atomic_compare_exchange_weak(&nano_http_stat.max_ns, &max, ns));
+	
+	return ret;
+}
@@ -0,0 +1,33 @@
+#ifndef NANOTODON_HTTP_H
+#define NANOTODON_HTTP_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <curl/curl.h>
+
+// リクエストごとの所要時間の統計
+struct nano_http_stats {
+	_Atomic uint64_t requests;
+	_Atomic uint64_t connects;	// 新しく接続した回数(再利用できなかった回数)
+	_Atomic uint64_t total_ns;
+	_Atomic uint64_t max_ns;
+	_Atomic uint64_t last_ns;
+};
+
+extern struct nano_http_stats nano_http_stat;
+
+// DNSとTLSセッションをすべてのハンドルで共有する,スレッドを作る前に呼ぶこと
+// 接続はスレッドごとに残したハンドルの中で再利用する
+int nano_http_init(void);
+void nano_http_cleanup(void);
+
+// 共有設定済みのハンドルを取り出す(HTTP/2が使えれば使う)
+CURL *nano_http_acquire(void);
+
+// 使い終わったハンドルを呼んだスレッドのために残す(次のnano_http_acquireで使う)
+void nano_http_release(CURL *hnd);
+
+// curl_easy_performをして所要時間を記録する
+CURLcode nano_http_perform(CURL *hnd);
+
+#endif
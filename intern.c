@@ -0,0 +1,62 @@
+#include <stdlib.h>
+#include <string.h>
+#include "intern.h"
+
+int nano_intern_init(struct nano_intern *in, size_t size)
+{
+	size_t n = 16;
+	while(n < size * 2) n <<= 1;
+	
+	memset(in, 0, sizeof(*in));
+	in->slots = calloc(n, sizeof(char *));
+	if(!in->slots) return 0;
+	in->mask = n - 1;
+	return 1;
+}
+
+void nano_intern_free(struct nano_intern *in)
+{
+	for(size_t i = 0; i <= in->mask; i++) free(in->slots[i]);
+	free(in->slots);
+	in->slots = NULL;
+}
+
+static size_t hash(const char *s)
+{
+	size_t h = 2166136261u;
+	while(*s) {
+		h ^= (unsigned char)*s++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+// 半分埋まったら倍にする
+static void grow(struct nano_intern *in)
+{
+	size_t n = (in->mask + 1) * 2;
+	char **slots = calloc(n, sizeof(char *));
+	if(!slots) return;
+	for(size_t i = 0; i <= in->mask; i++) {
+		if(!in->slots[i]) continue;
+		size_t j = hash(in->slots[i]) & (n - 1);
+		while(slots[j]) j = (j + 1) & (n - 1);
+		slots[j] = in->slots[i];
+	}
+	free(in->slots);
+	in->slots = slots;
+	in->mask = n - 1;
+}
+
+const char *nano_intern(struct nano_intern *in, const char *s)
+{
+	size_t i;
+	
+	for(i = hash(s) & in->mask; in->slots[i]; i = (i + 1) & in->mask) {
+		if(!strcmp(in->slots[i], s)) return in->slots[i];
+	}
+	char *d = strdup(s);
+	in->slots[i] = d;
+	if(++in->count * 2 > in->mask + 1) grow(in);
+	return d;
+}
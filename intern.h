@@ -0,0 +1,21 @@
+#ifndef NANOTODON_INTERN_H
+#define NANOTODON_INTERN_H
+
+#include <stddef.h>
+
+// 同じ内容の文字列を1つにまとめる集合(追加するだけで,個別には消さない)
+// ストリーム名のように種類が限られていて何度も出てくる文字列用
+// 追加は1つのスレッドからだけ行うこと,返したポインタはnano_intern_freeまで有効
+struct nano_intern {
+	char **slots;		// NULLは空き
+	size_t mask;		// 表の大きさ-1(2の冪)
+	size_t count;
+};
+
+int nano_intern_init(struct nano_intern *in, size_t size);
+void nano_intern_free(struct nano_intern *in);
+
+// sと同じ内容の文字列を返す(無ければ複製して加える)
+const char *nano_intern(struct nano_intern *in, const char *s);
+
+#endif
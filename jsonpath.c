@@ -0,0 +1,614 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jsonpath.h"
+
+// 同じ親の下でkey[0..len)のキーを探す,無ければ追加する
+static int find_or_add(struct nano_json_key *tmp, int *ntmp, int parent, const char *key, size_t len, int *parents)
+{
+	for(int i = 0; i < *ntmp; i++) {
+		if(parents[i] == parent && tmp[i].len == len && !memcmp(tmp[i].key, key, len)) return i;
+	}
+	if(*ntmp >= NANO_JSON_SCHEMA_KEYS || len > 255) return -1;
+	tmp[*ntmp].key = key;
+	tmp[*ntmp].len = len;
+	tmp[*ntmp].slot = -1;
+	tmp[*ntmp].nchild = 0;
+	tmp[*ntmp].hash = sjson_key_hash(key, (int)len);
+	parents[*ntmp] = parent;
+	return (*ntmp)++;
+}
+
+int nano_json_schema_compile(struct nano_json_schema *schema, const struct nano_json_field *fields, int nfields)
+{
+	struct nano_json_key tmp[NANO_JSON_SCHEMA_KEYS];
+	int parents[NANO_JSON_SCHEMA_KEYS], order[NANO_JSON_SCHEMA_KEYS];
+	int ntmp = 0;
+	
+	memset(schema, 0, sizeof(*schema));
+	
+	// まずパスを分解して(親,キー)の組を作る
+	for(int f = 0; f < nfields; f++) {
+		const char *p = fields[f].path;
+		int parent = -1, depth = 0, k = -1;
+		while(*p) {
+			size_t len = strcspn(p, "/");
+			if(++depth > NANO_JSON_PATH_DEPTH) return 0;
+			k = find_or_add(tmp, &ntmp, parent, p, len, parents);
+			if(k < 0) return 0;
+			parent = k;
+			p += len;
+			if(*p == '/') p++;
+		}
+		if(k < 0) return 0;
+		tmp[k].slot = fields[f].slot;
+		if(fields[f].slot >= schema->nslots) schema->nslots = fields[f].slot + 1;
+	}
+	
+	// 兄弟が連続するように幅優先で並べ直す
+	int n = 0;
+	for(int i = 0; i < ntmp; i++) if(parents[i] < 0) order[n++] = i;
+	schema->nroot = n;
+	for(int head = 0; head < n; head++) {
+		int first = n;
+		for(int i = 0; i < ntmp; i++) if(parents[i] == order[head]) order[n++] = i;
+		tmp[order[head]].child = first;
+		tmp[order[head]].nchild = n - first;
+	}
+	for(int i = 0; i < n; i++) {
+		schema->keys[i] = tmp[order[i]];
+		if(schema->keys[i].nchild == 0) schema->keys[i].child = 0;
+	}
+	schema->nkeys = n;
+	return 1;
+}
+
+// objのメンバとkeys[first..first+count)を突き合わせる
+static void extract_level(const struct nano_json_schema *schema, int first, int count, struct sjson_node *obj, struct sjson_node **out)
+{
+	int remain = count;
+	
+	if(obj->members) {
+		for(int i = first; i < first + count; i++) {
+			const struct nano_json_key *k = &schema->keys[i];
+			struct sjson_node *m = sjson_find_member_hashed(obj, k->key, k->len, k->hash);
+			if(!m) continue;
+			if(k->slot >= 0 && !out[k->slot]) out[k->slot] = m;
+			if(k->nchild > 0 && m->tag == SJSON_OBJECT) extract_level(schema, k->child, k->nchild, m, out);
+		}
+		return;
+	}
+	
+	for(struct sjson_node *m = obj->children.head; m && remain > 0; m = m->next) {
+		const char *key = m->key;
+		for(int i = first; i < first + count; i++) {
+			const struct nano_json_key *k = &schema->keys[i];
+			// 先頭の文字で大半をふるい落とす
+			if(key[0] != k->key[0] || strncmp(key, k->key, k->len) || key[k->len] != 0) continue;
+			
+			if(k->slot >= 0 && !out[k->slot]) out[k->slot] = m;
+			if(k->nchild > 0 && m->tag == SJSON_OBJECT) extract_level(schema, k->child, k->nchild, m, out);
+			remain--;
+			break;
+		}
+	}
+}
+
+void nano_json_extract(const struct nano_json_schema *schema, struct sjson_node *obj, struct sjson_node **out)
+{
+	for(int i = 0; i < schema->nslots; i++) out[i] = NULL;
+	if(obj && obj->tag == SJSON_OBJECT) extract_level(schema, 0, schema->nroot, obj, out);
+}
+
+struct sjson_node *nano_json_get(struct sjson_node *obj, const char *path)
+{
+	while(obj && *path) {
+		size_t len = strcspn(path, "/");
+		struct sjson_node *m = NULL;
+		
+		if(obj->tag != SJSON_OBJECT) return NULL;
+		if(obj->members) {
+			m = sjson_find_member_hashed(obj, path, (int)len, sjson_key_hash(path, (int)len));
+		} else {
+			for(m = obj->children.head; m; m = m->next) {
+				if(!strncmp(m->key, path, len) && m->key[len] == 0) break;
+			}
+		}
+		obj = m;
+		path += len;
+		if(*path == '/') path++;
+	}
+	return obj;
+}
+
+// <DOMを作らない読み取り>
+static const char *skip_ws(const char *p, const char *end)
+{
+	while(p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+	return p;
+}
+
+// pは"を指していること,閉じ"の次を返す
+static const char *skip_string(const char *p, const char *end)
+{
+	for(p++; p < end; p++) {
+		if(*p == '"') return p + 1;
+		if(*p == '\\') p++;
+	}
+	return NULL;
+}
+
+// 値1つを読み飛ばす,値の次を返す(不正ならNULL)
+static const char *skip_value(const char *p, const char *end)
+{
+	int depth = 0;
+	
+	if(p >= end) return NULL;
+	if(*p == '"') return skip_string(p, end);
+	
+	if(*p != '{' && *p != '[') {
+		// 数値,true,false,null
+		const char *q = p;
+		while(q < end && !strchr(",}] \t\r\n", *q)) q++;
+		return q > p ? q : NULL;
+	}
+	
+	// 括弧の対応だけを数える(文字列の中の括弧は数えない)
+	while(p < end) {
+		switch(*p) {
+		case '"':
+			p = skip_string(p, end);
+			if(!p) return NULL;
+			continue;
+		case '{':
+		case '[':
+			depth++;
+			break;
+		case '}':
+		case ']':
+			if(--depth == 0) return p + 1;
+			break;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+// pは{を指していること,keys[first..first+count)のフィールドを拾ってobjectの次を返す
+// need_endが0なら全部見つかった時点で打ち切る(戻り値はその位置)
+static const char *scan_level(const struct nano_json_schema *schema, int first, int count, const char *p, const char *end, struct nano_json_span *out, int need_end)
+{
+	int remain = count;
+	
+	p = skip_ws(p + 1, end);
+	if(p < end && *p == '}') return p + 1;
+	
+	while(p < end) {
+		const char *key, *key_end, *v;
+		const struct nano_json_key *match = NULL;
+		
+		if(*p != '"') return NULL;
+		key = p + 1;
+		p = skip_string(p, end);
+		if(!p) return NULL;
+		key_end = p - 1;
+		p = skip_ws(p, end);
+		if(p >= end || *p != ':') return NULL;
+		v = skip_ws(p + 1, end);
+		
+		// エスケープを含むキーはスキーマに無いものとして扱う
+		if(remain > 0) {
+			size_t klen = key_end - key;
+			for(int i = first; i < first + count; i++) {
+				const struct nano_json_key *k = &schema->keys[i];
+				if(k->len == klen && key[0] == k->key[0] && !memcmp(key, k->key, klen)) {
+					match = k;
+					break;
+				}
+			}
+		}
+		
+		if(match && match->nchild > 0 && v < end && *v == '{') {
+			p = scan_level(schema, match->child, match->nchild, v, end, out, 1);
+		} else {
+			p = skip_value(v, end);
+		}
+		if(!p) return NULL;
+		if(match) {
+			if(match->slot >= 0 && !out[match->slot].p) {
+				out[match->slot].p = v;
+				out[match->slot].len = p - v;
+			}
+			remain--;
+			if(remain == 0 && !need_end) return p;
+		}
+		
+		p = skip_ws(p, end);
+		if(p < end && *p == ',') {
+			p = skip_ws(p + 1, end);
+			continue;
+		}
+		if(p < end && *p == '}') return p + 1;
+		return NULL;
+	}
+	return NULL;
+}
+
+int nano_json_scan(const struct nano_json_schema *schema, const char *json, size_t len, struct nano_json_span *out)
+{
+	const char *end = json + len;
+	const char *p = skip_ws(json, end);
+	
+	for(int i = 0; i < schema->nslots; i++) {
+		out[i].p = NULL;
+		out[i].len = 0;
+	}
+	if(p >= end || *p != '{') return 0;
+	return scan_level(schema, 0, schema->nroot, p, end, out, 0) != NULL;
+}
+
+int nano_json_array_begin(struct nano_json_iter *it, struct nano_json_span arr)
+{
+	if(!arr.p || arr.len == 0 || arr.p[0] != '[') return 0;
+	it->p = arr.p + 1;
+	it->end = arr.p + arr.len;
+	return 1;
+}
+
+int nano_json_array_next(struct nano_json_iter *it, struct nano_json_span *elem)
+{
+	const char *p = skip_ws(it->p, it->end);
+	const char *q;
+	
+	if(p < it->end && *p == ',') p = skip_ws(p + 1, it->end);
+	if(p >= it->end || *p == ']') return 0;
+	q = skip_value(p, it->end);
+	if(!q) return 0;
+	elem->p = p;
+	elem->len = q - p;
+	it->p = q;
+	return 1;
+}
+
+int nano_json_is_object(struct nano_json_span v)
+{
+	return v.p && v.len > 0 && v.p[0] == '{';
+}
+
+static int hex4(const char *p)
+{
+	int v = 0;
+	for(int i = 0; i < 4; i++) {
+		char c = p[i];
+		v <<= 4;
+		if(c >= '0' && c <= '9') v |= c - '0';
+		else if(c >= 'a' && c <= 'f') v |= c - 'a' + 10;
+		else if(c >= 'A' && c <= 'F') v |= c - 'A' + 10;
+		else return -1;
+	}
+	return v;
+}
+
+static char *put_utf8(char *d, unsigned int c)
+{
+	if(c < 0x80) {
+		*d++ = c;
+	} else if(c < 0x800) {
+		*d++ = 0xC0 | (c >> 6);
+		*d++ = 0x80 | (c & 0x3F);
+	} else if(c < 0x10000) {
+		*d++ = 0xE0 | (c >> 12);
+		*d++ = 0x80 | ((c >> 6) & 0x3F);
+		*d++ = 0x80 | (c & 0x3F);
+	} else {
+		*d++ = 0xF0 | (c >> 18);
+		*d++ = 0x80 | ((c >> 12) & 0x3F);
+		*d++ = 0x80 | ((c >> 6) & 0x3F);
+		*d++ = 0x80 | (c & 0x3F);
+	}
+	return d;
+}
+
+// 文字列の値をデコードする,dstには値の長さ分あれば足りる(デコード後は短くなるだけ)
+static size_t unescape(struct nano_json_span v, char *dst)
+{
+	const char *p = v.p + 1, *end = v.p + v.len - 1;
+	char *d = dst;
+	
+	while(p < end) {
+		if(*p != '\\') {
+			*d++ = *p++;
+			continue;
+		}
+		if(++p >= end) break;
+		switch(*p) {
+		case 'b': *d++ = '\b'; break;
+		case 'f': *d++ = '\f'; break;
+		case 'n': *d++ = '\n'; break;
+		case 'r': *d++ = '\r'; break;
+		case 't': *d++ = '\t'; break;
+		case 'u': {
+			int c = end - p > 4 ? hex4(p + 1) : -1;
+			if(c < 0) break;
+			p += 4;
+			// サロゲートペア
+			if(c >= 0xD800 && c < 0xDC00 && end - p > 6 && p[1] == '\\' && p[2] == 'u') {
+				int lo = hex4(p + 3);
+				if(lo >= 0xDC00 && lo < 0xE000) {
+					c = 0x10000 + ((c - 0xD800) << 10) + (lo - 0xDC00);
+					p += 6;
+				}
+			}
+			d = put_utf8(d, c);
+			break;
+		}
+		default: *d++ = *p; break;
+		}
+		p++;
+	}
+	*d = 0;
+	return d - dst;
+}
+
+static int is_string(struct nano_json_span v)
+{
+	return v.p && v.len >= 2 && v.p[0] == '"';
+}
+
+char *nano_json_strdup(struct nano_json_span v, const char *def)
+{
+	if(!is_string(v)) return def ? strdup(def) : NULL;
+	char *s = malloc(v.len);
+	unescape(v, s);
+	return s;
+}
+
+int nano_json_strcpy(struct nano_json_span v, char *buf, size_t size)
+{
+	if(!is_string(v) || size == 0) return 0;
+	if(v.len <= size) {
+		unescape(v, buf);
+	} else {
+		char *tmp = malloc(v.len);
+		unescape(v, tmp);
+		snprintf(buf, size, "%s", tmp);
+		free(tmp);
+	}
+	return 1;
+}
+// </DOMを作らない読み取り>
+
+// <テープ>
+// 語は上位8ビットが種類(sjson_decode_tapeと同じ,ただし文字列は全て'"'),下位24ビットが
+//	'{' '['		対応する閉じの次の語の位置
+//	'}' ']'		対応する開きの位置
+//	'"' '0'		文字列領域での位置
+//	't' 'f' 'n'	0
+#define TAPE_WORD(tag, v) ((uint32_t)(unsigned char)(tag) << 24 | (uint32_t)(v))
+#define TAPE_TAG(w) ((char)((w) >> 24))
+#define TAPE_VALUE(w) ((w) & 0xFFFFFF)
+#define TAPE_TEXT(t) ((char *)((t)->words + (t)->nwords))
+
+// 同じキーを探す表の大きさ(2の冪),半分埋まったらそれ以降のキーは共有しない
+#define TAPE_KEY_SLOTS 128
+
+struct tape_builder {
+	struct nano_tape *t;
+	const uint64_t *in;	// sjson_decode_tapeの語
+	const char *json;
+	char *text;		// tの文字列領域
+	uint32_t used;
+	int nkeys;
+	struct {
+		uint32_t len;
+		uint32_t off;	// 文字列領域での位置+1(0なら空き)
+	} keys[TAPE_KEY_SLOTS];
+};
+
+// in[i]の文字列(デコードする)か数値の表記を文字列領域に置き,その位置を返す
+static uint32_t tape_put(struct tape_builder *b, size_t i)
+{
+	uint64_t w = b->in[i];
+	const char *src = b->json + SJSON_TAPE_OFFSET(w);
+	uint32_t off = b->used, len = SJSON_TAPE_LEN(w);
+	
+	if(SJSON_TAPE_TAG(w) == '\\') {
+		// srcの直前は開き"
+		struct nano_json_span v = { src - 1, len + 2 };
+		len = unescape(v, b->text + off);
+	} else {
+		memcpy(b->text + off, src, len);
+		b->text[off + len] = 0;
+	}
+	b->used += len + 1;
+	return off;
+}
+
+// キーを置く,同じキーを置いてあればそちらの位置を返す
+// キーは短く数も多いので,長さと3文字だけから表の位置を決め,写す前に探す(エスケープのあるキーは共有しない)
+static uint32_t tape_put_key(struct tape_builder *b, size_t i)
+{
+	uint64_t w = b->in[i];
+	const unsigned char *src = (const unsigned char *)b->json + SJSON_TAPE_OFFSET(w);
+	uint32_t len = SJSON_TAPE_LEN(w), h, off;
+	size_t slot;
+	
+	if(SJSON_TAPE_TAG(w) == '\\' || len == 0) return tape_put(b, i);
+	h = ((len * 31 + src[0]) * 31 + src[len / 2]) * 31 + src[len - 1];
+	for(slot = (h * 2654435761u >> 16) & (TAPE_KEY_SLOTS - 1); b->keys[slot].off; slot = (slot + 1) & (TAPE_KEY_SLOTS - 1)) {
+		off = b->keys[slot].off - 1;
+		if(b->keys[slot].len == len && !memcmp(b->text + off, src, len)) return off;
+	}
+	off = tape_put(b, i);
+	if(b->nkeys < TAPE_KEY_SLOTS / 2) {
+		b->keys[slot].len = len;
+		b->keys[slot].off = off + 1;
+		b->nkeys++;
+	}
+	return off;
+}
+
+// in[i]から値1つを詰め直し,次の値の位置を返す
+static size_t tape_convert(struct tape_builder *b, size_t i, int key)
+{
+	uint64_t w = b->in[i];
+	char tag = SJSON_TAPE_TAG(w);
+	uint32_t *out = b->t->words;
+	
+	switch(tag) {
+	case '{':
+	case '[': {
+		size_t close = SJSON_TAPE_OFFSET(w) - 1;
+		size_t j = i + 1;
+		while(j < close) {
+			if(tag == '{') j = tape_convert(b, j, 1);
+			j = tape_convert(b, j, 0);
+		}
+		out[i] = TAPE_WORD(tag, close + 1);
+		out[close] = TAPE_WORD(tag == '{' ? '}' : ']', i);
+		return close + 1;
+	}
+	case '"':
+	case '\\':
+		out[i] = TAPE_WORD('"', key ? tape_put_key(b, i) : tape_put(b, i));
+		return i + 1;
+	case '0':
+		out[i] = TAPE_WORD('0', tape_put(b, i));
+		return i + 1;
+	default:
+		out[i] = TAPE_WORD(tag, 0);
+		return i + 1;
+	}
+}
+
+struct nano_tape *nano_tape_build(sjson_context *ctx, const char *json, size_t len)
+{
+	struct tape_builder b;
+	struct nano_tape *t;
+	const uint64_t *words;
+	size_t bound = 0;
+	int nwords;
+	
+	if(len >= (1 << 24)) return NULL;
+	words = sjson_decode_tape(ctx, json, (int)len, &nwords);
+	if(!words || nwords == 0) return NULL;
+	
+	// 文字列領域はデコード前の長さの和で足りる(デコードとキーの共有で短くなるだけ)
+	for(int i = 0; i < nwords; i++) {
+		char type = SJSON_TAPE_TAG(words[i]);
+		if(type == '"' || type == '\\' || type == '0') bound += SJSON_TAPE_LEN(words[i]) + 1;
+	}
+	
+	t = malloc(sizeof(struct nano_tape) + sizeof(uint32_t) * nwords + bound);
+	if(!t) return NULL;
+	t->nwords = nwords;
+	b.t = t;
+	b.in = words;
+	b.json = json;
+	b.text = TAPE_TEXT(t);
+	b.used = 0;
+	b.nkeys = 0;
+	memset(b.keys, 0, sizeof(b.keys));
+	tape_convert(&b, 0, 0);
+	t->size = b.used;
+	
+	// 余った分を返す
+	b.t = realloc(t, nano_tape_bytes(t));
+	return b.t ? b.t : t;
+}
+
+size_t nano_tape_bytes(const struct nano_tape *t)
+{
+	return sizeof(struct nano_tape) + sizeof(uint32_t) * t->nwords + t->size;
+}
+
+struct nano_tape *nano_tape_dup(const struct nano_tape *t)
+{
+	struct nano_tape *d;
+	if(!t) return NULL;
+	d = malloc(nano_tape_bytes(t));
+	if(d) memcpy(d, t, nano_tape_bytes(t));
+	return d;
+}
+
+char nano_tape_type(const struct nano_tape *t, size_t i)
+{
+	return i < t->nwords ? TAPE_TAG(t->words[i]) : 0;
+}
+
+size_t nano_tape_skip(const struct nano_tape *t, size_t i)
+{
+	char type = nano_tape_type(t, i);
+	if(type == '{' || type == '[') return TAPE_VALUE(t->words[i]);
+	return i + 1;
+}
+
+size_t nano_tape_child(const struct nano_tape *t, size_t i)
+{
+	char type = nano_tape_type(t, i);
+	if(type != '{' && type != '[') return NANO_TAPE_NONE;
+	type = nano_tape_type(t, i + 1);
+	return type == '}' || type == ']' ? NANO_TAPE_NONE : i + 1;
+}
+
+size_t nano_tape_next(const struct nano_tape *t, size_t parent, size_t i)
+{
+	size_t next = nano_tape_skip(t, i);
+	return next + 1 < nano_tape_skip(t, parent) ? next : NANO_TAPE_NONE;
+}
+
+// objのキーとkeys[first..first+count)を突き合わせる
+static void tape_extract_level(const struct nano_json_schema *schema, int first, int count, const struct nano_tape *t, size_t obj, size_t *out)
+{
+	int remain = count;
+	
+	for(size_t m = nano_tape_child(t, obj); m != NANO_TAPE_NONE && remain > 0; m = nano_tape_next(t, obj, m + 1)) {
+		const char *key = TAPE_TEXT(t) + TAPE_VALUE(t->words[m]);
+		for(int i = first; i < first + count; i++) {
+			const struct nano_json_key *k = &schema->keys[i];
+			// 先頭の文字で大半をふるい落とす
+			if(key[0] != k->key[0] || strncmp(key, k->key, k->len) || key[k->len]) continue;
+			
+			if(k->slot >= 0 && out[k->slot] == NANO_TAPE_NONE) out[k->slot] = m + 1;
+			if(k->nchild > 0 && nano_tape_type(t, m + 1) == '{') tape_extract_level(schema, k->child, k->nchild, t, m + 1, out);
+			remain--;
+			break;
+		}
+	}
+}
+
+void nano_tape_extract(const struct nano_json_schema *schema, const struct nano_tape *t, size_t obj, size_t *out)
+{
+	for(int i = 0; i < schema->nslots; i++) out[i] = NANO_TAPE_NONE;
+	if(nano_tape_type(t, obj) == '{') tape_extract_level(schema, 0, schema->nroot, t, obj, out);
+}
+
+const char *nano_tape_str(const struct nano_tape *t, size_t i, const char *def)
+{
+	char type = nano_tape_type(t, i);
+	if(type != '"' && type != '0') return def;
+	return TAPE_TEXT(t) + TAPE_VALUE(t->words[i]);
+}
+
+struct nano_tape *nano_tape_drop_str(struct nano_tape *t, size_t i)
+{
+	char *text = TAPE_TEXT(t);
+	struct nano_tape *r;
+	uint32_t off, len;
+	
+	if(nano_tape_type(t, i) != '"') return t;
+	off = TAPE_VALUE(t->words[i]);
+	len = strlen(text + off);
+	if(len == 0) return t;
+	
+	// 後ろの文字列を前に寄せ,それを指す語をずらす(値の文字列を共有している語は無い)
+	memmove(text + off, text + off + len, t->size - off - len);
+	t->size -= len;
+	for(uint32_t j = 0; j < t->nwords; j++) {
+		char type = TAPE_TAG(t->words[j]);
+		if((type == '"' || type == '0') && TAPE_VALUE(t->words[j]) > off) t->words[j] -= len;
+	}
+	r = realloc(t, nano_tape_bytes(t));
+	return r ? r : t;
+}
+// </テープ>
@@ -0,0 +1,127 @@
+#ifndef NANOTODON_JSONPATH_H
+#define NANOTODON_JSONPATH_H
+
+#include <stdint.h>
+#include "sjson.h"
+
+// 1つのスキーマで扱えるキーの数と深さ
+#define NANO_JSON_SCHEMA_KEYS 32
+#define NANO_JSON_PATH_DEPTH 4
+
+// 取り出したいフィールド("account/acct"のように/区切りのパスと結果を入れる位置)
+struct nano_json_field {
+	const char *path;
+	int slot;
+};
+
+// パスをキーの木にしたもの,nano_json_schema_compileで一度だけ作る
+struct nano_json_key {
+	const char *key;	// 比較するキー(パスの中を指す)
+	unsigned char len;	// キーの長さ
+	signed char slot;	// 末端ならslot,途中なら-1
+	unsigned char child;	// 子のキーの先頭(keysの添字)
+	unsigned char nchild;	// 子のキーの数
+	uint32_t hash;		// sjson_key_hash,索引付きのオブジェクトを引くときに使う
+};
+
+struct nano_json_schema {
+	struct nano_json_key keys[NANO_JSON_SCHEMA_KEYS];
+	int nkeys;
+	int nroot;		// 最上位のキーの数(keys[0..nroot-1])
+	int nslots;
+};
+
+// フィールドの一覧をキーの木にする,成功すれば1
+// pathの文字列はスキーマを使う間ずっと有効であること
+int nano_json_schema_compile(struct nano_json_schema *schema, const struct nano_json_field *fields, int nfields);
+
+// objのメンバを一度だけ走査して全フィールドを取り出す(out[slot],無ければNULL)
+// objにキーの索引があれば(sjson_index_objects)走査せずにキーごとに索引を引く
+// ヒープは使わない
+void nano_json_extract(const struct nano_json_schema *schema, struct sjson_node *obj, struct sjson_node **out);
+
+// /区切りのパスを辿る(その都度パスを解釈する,起動時の設定読み込みなど用)
+struct sjson_node *nano_json_get(struct sjson_node *obj, const char *path);
+
+// <DOMを作らない読み取り>
+// JSONの文字列を先頭から読み,スキーマにあるフィールドの値の範囲だけを拾う
+// 使わない部分木(アカウントの絵文字やカードなど)は構造を追うだけで読み飛ばす
+
+// 元のJSON文字列の中の値1つ(文字列なら"から",オブジェクトなら{から)
+struct nano_json_span {
+	const char *p;		// 無ければNULL
+	size_t len;
+};
+
+// 配列の要素を順に取り出すためのカーソル
+struct nano_json_iter {
+	const char *p;
+	const char *end;
+};
+
+// objectの値を読み,out[slot]に各フィールドの値の範囲を入れる,不正なJSONなら0
+int nano_json_scan(const struct nano_json_schema *schema, const char *json, size_t len, struct nano_json_span *out);
+
+// 値が配列なら要素の取り出しを始める
+int nano_json_array_begin(struct nano_json_iter *it, struct nano_json_span arr);
+
+// 次の要素,無ければ(または不正なら)0
+int nano_json_array_next(struct nano_json_iter *it, struct nano_json_span *elem);
+
+// 値がオブジェクトか
+int nano_json_is_object(struct nano_json_span v);
+
+// 文字列の値をデコードして複製する,文字列でなければdefの複製(defがNULLならNULL)
+char *nano_json_strdup(struct nano_json_span v, const char *def);
+
+// 文字列の値をbufにデコードする(収まらなければ切り詰める),文字列でなければ0
+int nano_json_strcpy(struct nano_json_span v, char *buf, size_t size);
+// </DOMを作らない読み取り>
+
+// <テープ>
+// sjson_decode_tapeの語の列を,保持しておくTootのために詰め直したもの
+// 値1つ(キーも)が32ビットの語1つで,文字列と数値の表記は語の後ろの文字列領域に\0で終えて置く
+// 文字列はパーススレッドで作るときにデコードしておくので,読むときには書き換えない(どのスレッドから読んでもよい)
+// 同じキーは文字列領域に1つだけ置く,語と文字列領域は1回のmallocに収まっていて,freeで解放できる
+struct nano_tape {
+	uint32_t nwords;
+	uint32_t size;		// 文字列領域のバイト数
+	uint32_t words[];	// この後ろに文字列領域
+};
+
+#define NANO_TAPE_NONE ((size_t)-1)
+
+// lenバイトのJSONの値1つをctxで読んでテープにする,不正ならNULL
+// jsonの後ろは同じバッファのどこかで\0で終わっていること
+struct nano_tape *nano_tape_build(sjson_context *ctx, const char *json, size_t len);
+
+// 複製(テープは1つのブロックなのでそのままコピーする)
+struct nano_tape *nano_tape_dup(const struct nano_tape *t);
+
+// テープ全体のバイト数
+size_t nano_tape_bytes(const struct nano_tape *t);
+
+// i番目の値の種類('{'など,文字列は'"')
+char nano_tape_type(const struct nano_tape *t, size_t i);
+
+// i番目の値の次の語の位置
+size_t nano_tape_skip(const struct nano_tape *t, size_t i);
+
+// 配列かオブジェクトの最初の要素と,要素iの次の要素(無ければNANO_TAPE_NONE)
+// オブジェクトの要素はキーと値が交互に並ぶ
+size_t nano_tape_child(const struct nano_tape *t, size_t i);
+size_t nano_tape_next(const struct nano_tape *t, size_t parent, size_t i);
+
+// nano_json_extractのテープ版,objのキーを階層ごとに一度だけ走査してout[slot]に値の位置を入れる(無ければNANO_TAPE_NONE)
+void nano_tape_extract(const struct nano_json_schema *schema, const struct nano_tape *t, size_t obj, size_t *out);
+
+// 文字列(か数値の表記)の値,それ以外ならdef
+// ポインタはテープの中を指し,テープが生きている間有効
+const char *nano_tape_str(const struct nano_tape *t, size_t i, const char *def);
+
+// i番目の文字列の値を空にし,その分文字列領域を詰める(値に使う,キーは共有されているので使えない)
+// 縮めるためにreallocするので,新しいポインタを返す
+struct nano_tape *nano_tape_drop_str(struct nano_tape *t, size_t i);
+// </テープ>
+
+#endif
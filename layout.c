@@ -0,0 +1,356 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "layout.h"
+#include "width.h"
+
+void nano_layout_free(struct nano_layout *l)
+{
+	free(l->text);
+	free(l->runs);
+	free(l->rows);
+	free(l->breaks);
+	memset(l, 0, sizeof(*l));
+}
+
+void nano_layout_clear(struct nano_layout *l)
+{
+	l->width = 0;
+	l->nrows = 0;
+}
+
+// 容量をcount個以上にする
+static int reserve(void **p, size_t *cap, size_t count, size_t size)
+{
+	size_t n;
+	void *q;
+
+	if(count <= *cap) return 1;
+	n = *cap ? *cap : 16;
+	while(n < count) n *= 2;
+	q = realloc(*p, n * size);
+	if(!q) return 0;
+	*p = q;
+	*cap = n;
+	return 1;
+}
+
+void nano_layout_begin(struct nano_layout *l, int width)
+{
+	l->width = width > 0 ? width : 1;
+	l->nrows = 0;
+	l->len = 0;
+	l->nruns = 0;
+	l->nbreaks = 0;
+	l->line = 0;
+	l->attr = 0;
+	if(reserve((void **)&l->text, &l->text_cap, 1, 1)) l->text[0] = '\0';
+}
+
+static void add_row(struct nano_layout *l, size_t start, size_t end, size_t *run)
+{
+	if(!reserve((void **)&l->rows, &l->rows_cap, l->nrows + 1, sizeof(struct nano_layout_row))) return;
+	// 行頭を含むrunまで進める
+	while(*run + 1 < l->nruns && l->runs[*run].off + l->runs[*run].len <= start) (*run)++;
+	l->rows[l->nrows].start = (uint32_t)start;
+	l->rows[l->nrows].end = (uint32_t)end;
+	l->rows[l->nrows].run = (uint32_t)*run;
+	l->nrows++;
+}
+
+// 改行位置を決めるための文字の種類(UAX #14の分類を簡略にしたもの)
+enum break_class {
+	BRK_AL,		// 英字など(間では改行しない)
+	BRK_SP,		// 空白(後ろで改行できる)
+	BRK_ID,		// 漢字・かな・絵文字など全角の文字(前後で改行できる)
+	BRK_OP,		// 開き括弧(後ろで改行しない)
+	BRK_CL,		// 閉じ括弧,句読点,小書きのかななど(前で改行しない)
+	BRK_HY,		// ハイフン(後ろに英字が続けば改行できる)
+};
+
+// 行頭に来てはいけない全角の文字(UAX #14のCL, CP, EX, IS, NSのうち全角のもの)
+static const uint32_t cl_wide[] = {
+	0x3001, 0x3002, 0x3005, 0x3009, 0x300B, 0x300D, 0x300F, 0x3011, 0x3015, 0x3017,
+	0x3019, 0x301B, 0x301E, 0x301F, 0x303B, 0x3041, 0x3043, 0x3045, 0x3047, 0x3049,
+	0x3063, 0x3083, 0x3085, 0x3087, 0x308E, 0x3095, 0x3096, 0x309B, 0x309C, 0x309D,
+	0x309E, 0x30A0, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30C3, 0x30E3, 0x30E5,
+	0x30E7, 0x30EE, 0x30F5, 0x30F6, 0x30FB, 0x30FC, 0x30FD, 0x30FE, 0xFF01, 0xFF09,
+	0xFF0C, 0xFF0E, 0xFF1A, 0xFF1B, 0xFF1F, 0xFF3D, 0xFF5D, 0xFF60,
+};
+
+// 行末に来てはいけない全角の文字(UAX #14のOPのうち全角のもの)
+static const uint32_t op_wide[] = {
+	0x3008, 0x300A, 0x300C, 0x300E, 0x3010, 0x3014, 0x3016, 0x3018, 0x301A, 0x301D,
+	0xFF08, 0xFF3B, 0xFF5B, 0xFF5F,
+};
+
+static int in_list(const uint32_t *list, size_t n, uint32_t cp)
+{
+	size_t lo = 0, hi = n;
+
+	while(lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		if(list[mid] == cp) return 1;
+		if(list[mid] < cp) lo = mid + 1;
+		else hi = mid;
+	}
+	return 0;
+}
+
+static enum break_class break_class(uint32_t cp, int width)
+{
+	if(cp < 0x80) {
+		switch(cp) {
+		case ' ':
+			return BRK_SP;
+		case '(': case '[': case '{':
+			return BRK_OP;
+		case ')': case ']': case '}': case '!': case '?': case ',': case '.': case ':': case ';':
+			return BRK_CL;
+		case '-':
+			return BRK_HY;
+		default:
+			return BRK_AL;
+		}
+	}
+	if(width == 2) {
+		// 括弧や句読点はCJKの記号・かなと全角形の範囲にしかない
+		if(!(cp >= 0x3001 && cp <= 0x30FE) && !(cp >= 0xFF01 && cp <= 0xFF60)) return BRK_ID;
+		if(in_list(cl_wide, sizeof(cl_wide) / sizeof(cl_wide[0]), cp)) return BRK_CL;
+		if(in_list(op_wide, sizeof(op_wide) / sizeof(op_wide[0]), cp)) return BRK_OP;
+		return BRK_ID;
+	}
+	// 「…」「‥」や閉じ引用符は前で改行しない
+	if(cp == 0x2026 || cp == 0x2025 || cp == 0x2019 || cp == 0x201D) return BRK_CL;
+	if(cp == 0x2018 || cp == 0x201C) return BRK_OP;
+	return BRK_AL;
+}
+
+// prevとcurの間で改行できるか(空白の後ろは呼ぶ側で扱う)
+static int can_break(enum break_class prev, enum break_class cur, uint32_t cp)
+{
+	if(cur == BRK_CL || prev == BRK_OP) return 0;
+	if(prev == BRK_ID || cur == BRK_ID) return 1;
+	// "e-mail"は"-"の後ろで改行できるが,"-1"の前後では改行しない
+	if(prev == BRK_HY && cur == BRK_AL && !(cp >= '0' && cp <= '9')) return 1;
+	return 0;
+}
+
+// [start, end)を幅で折り返す
+// 改行できる位置(空白の後ろ,全角の文字の前後など)のうち入りきる最後の位置で折り返し,
+// そこまでで1行に入りきらない長い単語だけは書記素クラスタの区切りで切る
+// 行末からはみ出す空白は描かずに捨てる(制御文字はappendで空白にしてある)
+static void wrap_line(struct nano_layout *l, size_t start, size_t end, size_t *run)
+{
+	size_t pos = start, row = start;
+	size_t brk = 0;			// 今の行で最後に見つけた改行できる位置(0なら無し)
+	int x = 0, brk_x = 0;		// brk_xは行頭からbrkまでの幅
+	enum break_class prev = BRK_SP;
+
+	while(pos < end) {
+		const char *s = l->text + pos;
+		int size, n, w = nano_cluster_width(s, &size);
+		uint32_t cp = (uint8_t)*s < 0x80 ? (uint8_t)*s : nano_utf8_decode(s, &n);
+		enum break_class c = break_class(cp, w);
+
+		if(c == BRK_SP) {
+			if(x > 0 && x + w > l->width) {
+				// 入りきらない空白は捨てて次の行へ
+				add_row(l, row, pos, run);
+				while(pos < end && (l->text[pos] == ' ')) pos++;
+				row = pos;
+				x = 0;
+				brk = 0;
+				prev = BRK_SP;
+				continue;
+			}
+			x += w;
+			pos += size;
+			brk = pos;
+			brk_x = x;
+			prev = c;
+			continue;
+		}
+
+		if(pos > row && prev != BRK_SP && can_break(prev, c, cp)) {
+			brk = pos;
+			brk_x = x;
+		}
+		if(x > 0 && x + w > l->width) {
+			if(brk > row) {
+				add_row(l, row, brk, run);
+				row = brk;
+				x -= brk_x;
+			}
+			// 改行できる位置から先だけでも入りきらなければ単語の途中で切る
+			if(x > 0 && x + w > l->width) {
+				add_row(l, row, pos, run);
+				row = pos;
+				x = 0;
+			}
+			brk = 0;
+		}
+		x += w;
+		pos += size;
+		prev = c;
+	}
+	add_row(l, row, end, run);
+}
+
+void nano_layout_end(struct nano_layout *l)
+{
+	size_t start = 0, run = 0;
+
+	for(size_t i = 0; i < l->nbreaks; i++) {
+		wrap_line(l, start, l->breaks[i], &run);
+		start = l->breaks[i];
+	}
+	// 改行で終わっていない分(カーソルがある行)
+	if(start < l->len) wrap_line(l, start, l->len, &run);
+}
+
+void nano_layout_attron(struct nano_layout *l, uint32_t attr)
+{
+	l->attr |= attr;
+}
+
+void nano_layout_attroff(struct nano_layout *l, uint32_t attr)
+{
+	l->attr &= ~attr;
+}
+
+// cursesは制御文字を幅1では描かない(タブは次のタブ位置まで進み,他は^Xや~@になる)
+// 測った幅と描いた幅が食い違わないように,C0とC1の制御文字とDELは空白1つに置き換えて写す
+static size_t copy_text(char *dst, const char *s, size_t n)
+{
+	size_t j = 0;
+
+	for(size_t i = 0; i < n; i++) {
+		uint8_t c = (uint8_t)s[i];
+		if(c < 0x20 || c == 0x7f) {
+			dst[j++] = ' ';
+		} else if(c == 0xc2 && i + 1 < n && (uint8_t)s[i + 1] >= 0x80 && (uint8_t)s[i + 1] <= 0x9f) {
+			dst[j++] = ' ';
+			i++;
+		} else {
+			dst[j++] = (char)c;
+		}
+	}
+	return j;
+}
+
+// 改行を含まない文字列を今の属性で足す
+static void append(struct nano_layout *l, const char *s, size_t n)
+{
+	struct nano_layout_run *r;
+
+	if(n == 0) return;
+	if(!reserve((void **)&l->text, &l->text_cap, l->len + n + 1, 1)) return;
+	n = copy_text(l->text + l->len, s, n);
+
+	r = l->nruns ? &l->runs[l->nruns - 1] : NULL;
+	if(r && r->attr == l->attr && r->off + r->len == l->len) {
+		r->len += (uint32_t)n;
+	} else if(reserve((void **)&l->runs, &l->runs_cap, l->nruns + 1, sizeof(struct nano_layout_run))) {
+		r = &l->runs[l->nruns++];
+		r->off = (uint32_t)l->len;
+		r->len = (uint32_t)n;
+		r->attr = l->attr;
+	}
+	l->len += n;
+	l->text[l->len] = '\0';
+}
+
+static void newline(struct nano_layout *l)
+{
+	if(!reserve((void **)&l->breaks, &l->breaks_cap, l->nbreaks + 1, sizeof(uint32_t))) return;
+	l->breaks[l->nbreaks++] = (uint32_t)l->len;
+	l->line = l->len;
+}
+
+void nano_layout_addnstr(struct nano_layout *l, const char *s, size_t n)
+{
+	const char *nl;
+
+	while(n > 0 && (nl = memchr(s, '\n', n)) != NULL) {
+		append(l, s, nl - s);
+		newline(l);
+		n -= nl - s + 1;
+		s = nl + 1;
+	}
+	append(l, s, n);
+}
+
+void nano_layout_addstr(struct nano_layout *l, const char *s)
+{
+	nano_layout_addnstr(l, s, strlen(s));
+}
+
+void nano_layout_addch(struct nano_layout *l, char c)
+{
+	nano_layout_addnstr(l, &c, 1);
+}
+
+void nano_layout_printf(struct nano_layout *l, const char *fmt, ...)
+{
+	char buf[256], *p = buf;
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+	if(n < 0) return;
+
+	// 入りきらなければ確保して書き直す
+	if((size_t)n >= sizeof(buf)) {
+		p = malloc(n + 1);
+		if(!p) return;
+		va_start(ap, fmt);
+		vsnprintf(p, n + 1, fmt, ap);
+		va_end(ap);
+	}
+	nano_layout_addnstr(l, p, n);
+	if(p != buf) free(p);
+}
+
+int nano_layout_x(const struct nano_layout *l)
+{
+	int x = 0, size;
+
+	for(size_t pos = l->line; pos < l->len; pos += size) x += nano_cluster_width(l->text + pos, &size);
+	return x;
+}
+
+void nano_layout_move_x(struct nano_layout *l, int x)
+{
+	size_t pos = l->line;
+	int cx = 0, size;
+
+	// xに収まるところまで進む
+	while(pos < l->len) {
+		int w = nano_cluster_width(l->text + pos, &size);
+		if(cx + w > x) break;
+		cx += w;
+		pos += size;
+	}
+
+	// 先は切り詰める
+	if(pos < l->len) {
+		while(l->nruns > 0 && l->runs[l->nruns - 1].off >= pos) l->nruns--;
+		if(l->nruns > 0 && l->runs[l->nruns - 1].off + l->runs[l->nruns - 1].len > pos) {
+			l->runs[l->nruns - 1].len = (uint32_t)(pos - l->runs[l->nruns - 1].off);
+		}
+		l->len = pos;
+		l->text[l->len] = '\0';
+	}
+
+	// 足りない分は空白で埋める
+	while(cx < x) {
+		static const char spaces[] = "                                ";
+		int n = x - cx < (int)sizeof(spaces) - 1 ? x - cx : (int)sizeof(spaces) - 1;
+		append(l, spaces, n);
+		cx += n;
+	}
+}
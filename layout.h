@@ -0,0 +1,67 @@
+#ifndef NANOTODON_LAYOUT_H
+#define NANOTODON_LAYOUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 属性付きの文字列の一続き(textの[off, off+len))
+struct nano_layout_run {
+	uint32_t off;
+	uint32_t len;
+	uint32_t attr;		// cursesの属性(COLOR_PAIR|A_BOLDなど)
+};
+
+// 画面の1行(textの[start, end),runは行頭を含むrun)
+struct nano_layout_row {
+	uint32_t start;
+	uint32_t end;
+	uint32_t run;
+};
+
+// レコード1件を決まった幅で折り返した表示内容
+// cursesへ直接描く代わりにここへ書き,描くときは見えている行だけをrunごとに出す
+// 書き込みはwaddstrなどと同じく,端まで来たら次の行へ,'\n'で改行
+struct nano_layout {
+	int width;			// 折り返した幅(0なら未作成)
+	int nrows;
+
+	char *text;			// 改行を除いた文字列
+	size_t len, text_cap;
+	struct nano_layout_run *runs;
+	size_t nruns, runs_cap;
+	struct nano_layout_row *rows;
+	size_t rows_cap;
+
+	uint32_t *breaks;		// 改行した位置(textの添字)
+	size_t nbreaks, breaks_cap;
+	size_t line;			// 今の行の先頭(textの添字)
+	uint32_t attr;			// 今の属性
+};
+
+// 全ての領域を解放する(0で埋めた状態は空のレイアウトとして使える)
+void nano_layout_free(struct nano_layout *l);
+
+// 作成済みの印を消す(領域は次に作るときに使い回す)
+void nano_layout_clear(struct nano_layout *l);
+
+// 幅widthで作り直し始める
+void nano_layout_begin(struct nano_layout *l, int width);
+
+// 書いた内容を折り返して行に分ける
+void nano_layout_end(struct nano_layout *l);
+
+void nano_layout_attron(struct nano_layout *l, uint32_t attr);
+void nano_layout_attroff(struct nano_layout *l, uint32_t attr);
+
+void nano_layout_addnstr(struct nano_layout *l, const char *s, size_t n);
+void nano_layout_addstr(struct nano_layout *l, const char *s);
+void nano_layout_addch(struct nano_layout *l, char c);
+void nano_layout_printf(struct nano_layout *l, const char *fmt, ...);
+
+// 今の行の桁
+int nano_layout_x(const struct nano_layout *l);
+
+// 今の行の桁xへ移る(手前なら空白で埋め,先なら切り詰める)
+void nano_layout_move_x(struct nano_layout *l, int x);
+
+#endif
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# HTML5の文字参照の表(entities.h)を作る
+# 使い方: make entities-table (python3 mkentities.py > entities.h と同じ)
+#
+# 名前から表の位置を衝突なしに求める完全ハッシュにする(hash and displace)
+#   バケット = fnv(名前, 0) % BUCKETS
+#   位置     = fnv(名前, disp[バケット]) % COUNT
+# html.cのentity_hashと同じ計算をすること
+
+from html.entities import html5
+
+def fnv(s, seed):
+	h = (2166136261 ^ seed) & 0xffffffff
+	for c in s.encode():
+		h ^= c
+		h = (h * 16777619) & 0xffffffff
+	return h
+
+def c_string(s):
+	out = ''
+	for b in s.encode():
+		if 0x20 <= b < 0x7f and b not in (0x22, 0x5c, 0x3f):
+			out += chr(b)
+		else:
+			out += '\\%03o' % b
+	return '"' + out + '"'
+
+names = sorted(html5)
+count = len(names)
+nbuckets = count // 3
+
+buckets = [[] for _ in range(nbuckets)]
+for name in names:
+	buckets[fnv(name, 0) % nbuckets].append(name)
+
+slots = [None] * count
+disp = [0] * nbuckets
+for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+	if not buckets[b]:
+		continue
+	for d in range(1, 65536):
+		pos = [fnv(name, d) % count for name in buckets[b]]
+		if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+			break
+	else:
+		raise SystemExit('no displacement for bucket %d' % b)
+	disp[b] = d
+	for name, p in zip(buckets[b], pos):
+		slots[p] = name
+
+print('// HTML5の文字参照の表(mkentities.pyで生成,手で編集しない)')
+print('#define NANO_ENTITY_COUNT %d' % count)
+print('#define NANO_ENTITY_BUCKETS %d' % nbuckets)
+print('#define NANO_ENTITY_NAME_MAX %d' % max(len(n) for n in names))
+print()
+print('static const uint16_t entity_disp[NANO_ENTITY_BUCKETS] = {')
+for i in range(0, nbuckets, 12):
+	print('\t' + ', '.join(str(d) for d in disp[i:i + 12]) + ',')
+print('};')
+print()
+print('// 名前(;が付かないものは古い書き方で許されているもの)と値のUTF-8')
+print('static const struct entity {')
+print('\tconst char *name;')
+print('\tconst char *value;')
+print('} entities[NANO_ENTITY_COUNT] = {')
+for name in slots:
+	print('\t{ %s, %s },' % (c_string(name), c_string(html5[name])))
+print('};')
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# 文字の表示幅の表(width_table.h)を作る
+# 使い方: python3 mkwidth.py [UnicodeData.txt EastAsianWidth.txt] > width_table.h
+# データファイルを渡さなければPythonのunicodedataを使う(make width-tableはunicode.orgのファイルから作る)
+#
+# 幅は0(結合文字など),1,2(East Asian WidthがWかF)の3つ
+# 2段の表にする: stage1[cp >> 8]が256文字ごとのブロックの番号,
+# stage2はブロックごとに1文字2ビットで詰めたもの(同じ内容のブロックは共有する)
+
+import re
+import sys
+
+MAX = 0x110000
+
+# 未割り当てでもWとして扱う範囲(UAX #11)
+WIDE_DEFAULT = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+# PropList.txtのPrepended_Concatenation_Mark
+PREPENDED_CONCATENATION_MARK = set(list(range(0x0600, 0x0606)) + [0x06DD, 0x070F, 0x0890, 0x0891, 0x08E2, 0x110BD, 0x110CD])
+
+def ranges(path):
+	# "XXXX;..." か "XXXX..YYYY;..." の行を読む
+	for line in open(path, encoding='utf-8'):
+		line = line.split('#')[0].strip()
+		if not line:
+			continue
+		fields = [f.strip() for f in line.split(';')]
+		r = fields[0].split('..')
+		yield int(r[0], 16), int(r[-1], 16), fields
+
+def load_files(unicode_data, east_asian_width):
+	category = ['Cn'] * MAX
+	first = None
+	for lo, hi, f in ranges(unicode_data):
+		# <CJK Ideograph, First>〜<..., Last>は範囲
+		if f[1].endswith(', First>'):
+			first = lo
+			continue
+		if f[1].endswith(', Last>'):
+			lo = first
+		for cp in range(lo, hi + 1):
+			category[cp] = f[2]
+	eaw = ['N'] * MAX
+	for lo, hi, f in ranges(east_asian_width):
+		for cp in range(lo, hi + 1):
+			eaw[cp] = f[1]
+	return category, eaw
+
+def file_version(path):
+	# 1行目の "# EastAsianWidth-14.0.0.txt" から版を読む
+	m = re.search(r'-(\d+\.\d+\.\d+)\.txt', open(path, encoding='utf-8').readline())
+	return m.group(1) if m else '?'
+
+def load_module():
+	import unicodedata
+	category = [unicodedata.category(chr(cp)) for cp in range(MAX)]
+	eaw = [unicodedata.east_asian_width(chr(cp)) for cp in range(MAX)]
+	return category, eaw
+
+def width(cp, category, eaw):
+	c = category[cp]
+	if cp < 0x80:
+		return 1			# ASCIIは制御文字も1(以前のustrwidthと同じ)
+	if cp == 0x00AD or cp in PREPENDED_CONCATENATION_MARK:
+		return 1			# SOFT HYPHENと数字の前に付ける記号(書式文字だが表示される)
+	if c in ('Mn', 'Me', 'Cf', 'Cc', 'Cs'):
+		return 0
+	if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+		return 0			# ハングルの中声・終声字母(前の字母と合わさる)
+	if eaw[cp] in ('W', 'F'):
+		return 2
+	if c == 'Cn' and any(lo <= cp <= hi for lo, hi in WIDE_DEFAULT):
+		return 2
+	return 1
+
+def main():
+	if len(sys.argv) == 3:
+		category, eaw = load_files(sys.argv[1], sys.argv[2])
+		source = 'UnicodeData.txt, EastAsianWidth.txt %s' % file_version(sys.argv[2])
+	else:
+		import unicodedata
+		category, eaw = load_module()
+		source = 'unicodedata %s' % unicodedata.unidata_version
+
+	blocks = {}
+	stage1 = []
+	stage2 = []
+	for hi in range(MAX >> 8):
+		packed = []
+		for i in range(0, 256, 4):
+			b = 0
+			for j in range(4):
+				b |= width((hi << 8) + i + j, category, eaw) << (j * 2)
+			packed.append(b)
+		key = tuple(packed)
+		if key not in blocks:
+			blocks[key] = len(stage2)
+			stage2.append(key)
+		stage1.append(blocks[key])
+
+	if len(stage2) > 256:
+		raise SystemExit('too many blocks')
+
+	print('// 文字の表示幅の表(mkwidth.pyで %s から生成,手で編集しない)' % source)
+	print('#define NANO_WIDTH_BLOCKS %d' % len(stage2))
+	print()
+	print('static const uint8_t width_stage1[0x110000 >> 8] = {')
+	for i in range(0, len(stage1), 16):
+		print('\t' + ', '.join(str(v) for v in stage1[i:i + 16]) + ',')
+	print('};')
+	print()
+	print('static const uint8_t width_stage2[NANO_WIDTH_BLOCKS][64] = {')
+	for block in stage2:
+		print('\t{')
+		for i in range(0, 64, 16):
+			print('\t\t' + ', '.join('0x%02x' % v for v in block[i:i + 16]) + ',')
+		print('\t},')
+	print('};')
+
+main()
@@ -1,40 +1,161 @@
 #include <curl/curl.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <limits.h> // INT_MAX
 #include <string.h> // memmove
-#include <time.h>   // strptime, strptime, timegm, localtime
+#include <time.h>   // time_t
 #include <ctype.h>  // isspace
 #include <locale.h> // setlocale
 #include <curses.h>
 #include <ncurses.h>
 #include <pthread.h>
+#include <stdarg.h> // va_list
+#include <unistd.h> // getpid
+#include <poll.h>   // poll
+#include <signal.h> // pthread_sigmask
 #include "config.h"
 #include "messages.h"
+#include "sse.h"
+#include "ws.h"
+#include "http.h"
+#include "queue.h"
+#include "status.h"
+#include "timeline.h"
+#include "intern.h"
+#include "seen.h"
+#include "arena.h"
+#include "pool.h"
 
-#define SJSON_IMPLEMENT
 #include "sjson.h"
+#include "jsonpath.h"
+#include "html.h"
+#include "width.h"
+#include "datetime.h"
 
-char *streaming_json = NULL;
+// ストリーミング受信用SSEパーサ
+struct nano_sse_parser streaming_sse;
+
+// 表示済みのレコード(UIスレッドのみが触る)
+struct nano_timeline timeline;
 
 #define URI_STREAM "api/v1/streaming/"
+#define URI_STREAM_WS "api/v1/streaming"
+
+// WebSocketで同時に購読できるストリームの数
+#define MAX_SUBSCRIPTIONS 8
+
 #define URI_TIMELINE "api/v1/timelines/"
 
+// 再接続時の取りこぼし補完で1回に取得する件数と最大ページ数
+#define BACKFILL_LIMIT 40
+#define BACKFILL_MAX_PAGES 5
+
+// 再接続待ち時間(ミリ秒)、失敗するたびに倍にする
+#define RECONNECT_DELAY_MIN 1000
+#define RECONNECT_DELAY_MAX 60000
+
+// この秒数以上何も受信しなければ(サーバは定期的に":thump"を送る)切断とみなす
+#define STREAM_STALL_TIMEOUT 90
+
+// 受信→パース、パース→表示の各キューの容量
+#define RAW_QUEUE_SIZE 256
+#define UI_QUEUE_SIZE 1024
+
+// 画面更新の最大頻度(回/秒)のデフォルト
+#define DEFAULT_FRAME_RATE 20
+
+// 保持しておく表示済みレコードの数(さかのぼって表示できる分,描き直しと削除・編集にも使う)
+#define TIMELINE_MAX 4096
+
+// 重複を除くために覚えておくToot IDの数(この2倍まで覚えている)
+#define SEEN_IDS_MAX 4096
+
+// タイムライン取得を待つ間に溜めておくストリーミングのレコードの上限
+#define HELD_RECORDS_MAX 512
+
+// タイムラインのページをデコードするスレッド数の上限(-parse-threadsが無いときはCPUの数まで)
+#define PARSE_THREADS_MAX 8
+
+// 要素がこれ未満のページはパーススレッドだけで読む
+// Toot1つのデコードは約15us,ワーカーに渡して起こす手間はページあたり数十us(bench_timelineの2スレッドと1スレッドの差)なので,
+// 8つ(約120us)より少なければ分けても速くならない
+#define PARALLEL_DECODE_MIN 8
+
+// 使い回すsjsonコンテキストが想定するペイロード長の最小と最大
+// 最大を超えるものはその場限りのコンテキストで読む
+#define JSON_PAYLOAD_MIN 4096
+#define JSON_PAYLOAD_MAX (1024 * 1024)
+
 char *selected_stream = "user";
 char *selected_timeline = "home";
 
-#define CURL_USERAGENT "curl/" LIBCURL_VERSION
+// WebSocketで追加購読するストリーム(-subscribe)
+char *subscriptions[MAX_SUBSCRIPTIONS];
+int subscription_count = 0;
 
-// ストリーミングを受信する関数のポインタ
-void (*streaming_received_handler)(void);
+#define CURL_USERAGENT "curl/" LIBCURL_VERSION
 
-// 受信したストリーミングを処理する関数のポインタ
-void (*stream_event_handler)(struct sjson_node *);
+// ストリーミングで受信したイベントの処理
+void streaming_received(struct nano_sse_event *, void *);
+
+// 受信スレッドからパーススレッドへ渡す生のイベント
+enum raw_event_kind {
+	RAW_STREAM,	// ストリーミングで受信したイベント
+	RAW_WS,		// WebSocketで受信したメッセージ(JSON)
+	RAW_TIMELINE,	// REST APIで取得したタイムライン(JSON配列)
+	RAW_NOTICE,	// お知らせ文字列
+	RAW_HOLD,	// 取りこぼし補完を依頼した,結果が届くまでストリーミングの分は表示を保留する(lenは依頼の番号)
+	RAW_RELEASE,	// 依頼されたタイムライン取得が終わった(lenはこれまでに終えた依頼の番号)
+};
+
+struct raw_event {
+	enum raw_event_kind kind;
+	char type[NANO_SSE_TYPE_LEN];
+	char *data;
+	size_t len;
+};
+
+// 受信スレッド→パーススレッド
+struct nano_queue raw_queue;
+
+// タイムライン取得スレッド→パーススレッド
+struct nano_queue rest_queue;
+
+// パーススレッド→UIスレッド(メインスレッド)
+struct nano_queue ui_queue;
+
+// 各段の処理時間
+struct stage_stat {
+	_Atomic uint64_t count;
+	_Atomic uint64_t total_ns;
+	_Atomic uint64_t max_ns;
+};
+
+struct stage_stat parse_stat, render_stat;
+
+// 画面更新の統計
+struct frame_stats {
+	uint64_t frames;	// 画面を更新した回数
+	uint64_t records;	// 表示したレコード数
+	uint64_t max_records;	// 1回の更新でまとめたレコード数の最大
+} frame_stat;
+
+// タイムライン取得スレッドへの依頼
+struct fetch_request {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	int initial;			// 起動時の取得
+	unsigned int backfills;		// 取りこぼし補完の依頼数(それぞれRAW_HOLDを送ってある)
+	unsigned int hold_seq;		// 最後に付けた依頼の番号(起動時の取得が1)
+	char backfill_min_id[32];	// 補完はこれより新しいものから
+} fetch_req = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 1, 0, 1, "" };
 
 // インスタンスにクライアントを登録する
 void do_create_client(char *, char *);
 
-// Timelineの受信
-void get_timeline(void);
+// Timelineの受信(min_idを指定するとそれより新しいものだけ),タイムライン取得スレッドで呼ばれる
+// 成功すれば受信したバイト数、失敗時は-1を返す,next_min_idには次のページのmin_idが入る
+int get_timeline(const char *min_id, int limit, char *next_min_id);
 
 // 承認コードを使ったOAuth処理
 void do_oauth(char *code, char *ck, char *cs);
@@ -42,11 +163,17 @@ void do_oauth(char *code, char *ck, char *cs);
 // Tootを行う
 void do_toot(char *);
 
-// ストリーミングでのToot受信処理,stream_event_handlerへ代入
-void stream_event_update(struct sjson_node *);
+// JSONからTootのレコードを作る,パーススレッドで呼ばれる
+struct nano_status *build_status(sjson_context *ctx, const char *json, size_t len);
 
-// ストリーミングでの通知受信処理,stream_event_handlerへ代入
-void stream_event_notify(struct sjson_node *);
+// JSONから通知のレコードを作る,パーススレッドで呼ばれる
+struct nano_notification *build_notification(sjson_context *ctx, const char *json, size_t len);
+
+// Tootの表示,UIスレッドで呼ばれる
+void render_status(struct nano_layout *, struct nano_status *);
+
+// 通知の表示,UIスレッドで呼ばれる
+void render_notification(struct nano_layout *, struct nano_notification *);
 
 // タイムラインWindow
 WINDOW *scr;
@@ -68,56 +195,26 @@ int pad_x = 0, pad_y = 0;
 int monoflag = 0;
 int hidlckflag = 1;
 int noemojiflag = 0;
-
-// Unicode文字列の幅を返す(半角文字=1)
-int ustrwidth(const char *str)
-{
-	int size, width, strwidth;
-
-	strwidth = 0;
-	while (*str != '\0') {
-		uint8_t c;
-		c = (uint8_t)*str;
-		if (c >= 0x00 && c <= 0x7f) {
-			size  = 1;
-			width = 1;
-		} else if (c >= 0xc2 && c <= 0xdf) {
-			size  = 2;
-			width = 2;
-		} else if (c == 0xef) {
-			uint16_t p;
-			p = ((uint8_t)str[1] << 8) | (uint8_t)str[2];
-			size  = 3;
-			if (p >= 0xbda1 && p <= 0xbe9c) {
-				/* Halfwidth CJK punctuation */
-				/* Halfwidth Katakana variants */
-				/* Halfwidth Hangul variants */
-				width = 1;
-			} else if (p >= 0xbfa8 && p <= 0xbfae) {
-				/* Halfwidth symbol variants */
-				width = 1;
-			} else {
-				/* other BMP */
-				width = 2;
-			}
-		} else if ((c & 0xf0) == 0xe0) {
-			/* other BMP */
-			size  = 3;
-			width = 2;
-		} else if ((c & 0xf8) == 0xf0) {
-			/* Emoji etc. */
-			size  = 4;
-			width = 2;
-		} else {
-			/* unexpected */
-			size  = 1;
-			width = 1;
-		}
-		strwidth += width;
-		str += size;
-	}
-	return strwidth;
-}
+int statsflag = 0;
+int wsflag = 0;
+int frame_rate = DEFAULT_FRAME_RATE;
+int parse_threads = 0;
+
+// 表示済みの中で最新のステータスID(再接続時の補完に使う)
+char newest_status_id[32] = "";
+pthread_mutex_t newest_status_id_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// ストリーミング接続の状態と統計(書くのはストリーミングスレッドだけ)
+// 統計の表示でUIスレッドからも読むものはアトミックにしておく
+struct stream_stats {
+	int connected;			// 現在のストリームでデータを受信したか
+	int disconnected;		// 切断中(補完が必要)
+	_Atomic unsigned int reconnects;	// 再接続に成功した回数
+	_Atomic unsigned int attempts;		// 再接続を試みた回数
+	struct timespec down_since;	// 切断された時刻
+	_Atomic double last_outage;	// 直近の切断時間(秒)
+	double total_outage;		// 切断時間の累計(秒)
+} stream_stat;
 
 // curlのエラーを表示
 void curl_fatal(CURLcode ret, const char *errbuf)
@@ -136,52 +233,125 @@ void curl_fatal(CURLcode ret, const char *errbuf)
 // domain_stringとapiエンドポイントを合成してURLを生成する
 char *create_uri_string(char *api)
 {
-	char *s = malloc(256);
+	char *s = malloc(strlen(domain_string) + strlen(api) + 10);
 	sprintf(s, "https://%s/%s", domain_string, api);
 	return s;
 }
 
-// jsonツリーをパス形式(ex. "account/display_name")で掘ってjson_objectを取り出す
-int read_json_fom_path(struct sjson_node *obj, char *path, struct sjson_node **dst)
+// 経過時間計測用(秒)
+double elapsed_since(const struct timespec *t)
 {
-	char *dup = strdup(path);	// strtokは破壊するので複製
-	struct sjson_node *dir = obj;
-	int exist = 1;
-	char *next_key;
-	char last_key[256];
-	
-	char *tok = dup;
-	
-	// 現在地ノードが存在する限りループ
-	while(exist) {
-		// 次のノード名を取り出す
-		next_key = strtok(tok, "/");
-		tok = NULL;
-		
-		// パスの終端(=目的のオブジェクトに到達している)ならループを抜ける
-		if(!next_key) break;
-		strcpy(last_key, next_key);
-		
-		// 次のノードを取得する
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - t->tv_sec) + (now.tv_nsec - t->tv_nsec) / 1e9;
+}
 
-		struct sjson_node *next = sjson_find_member(dir, next_key);
+// 処理時間を記録する
+void stage_stat_add(struct stage_stat *st, uint64_t ns)
+{
+	atomic_fetch_add_explicit(&st->count, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&st->total_ns, ns, memory_order_relaxed);
+	if(ns > atomic_load_explicit(&st->max_ns, memory_order_relaxed)) {
+		atomic_store_explicit(&st->max_ns, ns, memory_order_relaxed);
+	}
+}
 
-		exist = next != 0 ? 1 : 0;
+// 受信スレッドやタイムライン取得スレッドからパーススレッドへイベントを渡す(dataの所有権も渡す)
+// qはraw_queue(受信スレッド)かrest_queue(取得スレッド)
+void push_raw_event(struct nano_queue *q, enum raw_event_kind kind, const char *type, char *data, size_t len)
+{
+	struct raw_event *ev = malloc(sizeof(struct raw_event));
+	ev->kind = kind;
+	snprintf(ev->type, sizeof(ev->type), "%s", type ? type : "");
+	ev->data = data;
+	ev->len = len;
+	nano_queue_push(q, ev);
+}
 
-		if(exist) {
-			// 存在しているので現在地ノードを更新
-			dir = next;
-		}
-	}
+// タイムラインにお知らせを1行表示する,受信スレッドか取得スレッドから呼ばれる
+void post_notice(struct nano_queue *q, const char *fmt, ...)
+{
+	char buf[512];
+	va_list ap;
+	va_start(ap, fmt);
+	vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+	push_raw_event(q, RAW_NOTICE, NULL, strdup(buf), strlen(buf));
+}
+
+// ステータスIDの比較(数値文字列なので桁数が多い方が新しい)
+int status_id_cmp(const char *a, const char *b)
+{
+	size_t la = strlen(a), lb = strlen(b);
+	if(la != lb) return la < lb ? -1 : 1;
+	return strcmp(a, b);
+}
+
+// 表示したステータスのIDを記録する,パーススレッドで呼ばれる
+void note_status_id(const struct nano_status *st)
+{
+	if(!st || !st->id || strlen(st->id) >= sizeof(newest_status_id)) return;
+	pthread_mutex_lock(&newest_status_id_lock);
+	if(status_id_cmp(st->id, newest_status_id) > 0) strcpy(newest_status_id, st->id);
+	pthread_mutex_unlock(&newest_status_id_lock);
+}
+
+// 切断中に取りこぼしたステータスを取得する,タイムライン取得スレッドで呼ばれる
+void stream_backfill(const char *since_id)
+{
+	int pages = 0;
+	char min_id[sizeof(newest_status_id)], next_min_id[sizeof(newest_status_id)];
 	
-	// strtok用バッファ解放
-	free(dup);
+	strcpy(min_id, since_id);
+	if(min_id[0] == 0) {
+		get_timeline(NULL, 0, NULL);
+		return;
+	}
 	
-	// 現在地を結果ポインタに代入
-	*dst = dir;
+	// min_idより新しいものを古い順にページ単位で辿る(次のページはLinkヘッダのprevで示される)
+	while(get_timeline(min_id, BACKFILL_LIMIT, next_min_id) > 0 && next_min_id[0] && ++pages < BACKFILL_MAX_PAGES) {
+		strcpy(min_id, next_min_id);
+	}
+}
+
+// タイムライン取得スレッドに仕事を頼む,依頼の番号を返す
+unsigned int request_fetch(const char *backfill_min_id)
+{
+	unsigned int seq;
 	
-	// 見つかったかどうかを返却
-	return exist;
+	pthread_mutex_lock(&fetch_req.lock);
+	// 補完がまだなら古い方から取る
+	if(fetch_req.backfills == 0 || status_id_cmp(backfill_min_id, fetch_req.backfill_min_id) < 0) {
+		strcpy(fetch_req.backfill_min_id, backfill_min_id);
+	}
+	fetch_req.backfills++;
+	seq = ++fetch_req.hold_seq;
+	pthread_cond_signal(&fetch_req.cond);
+	pthread_mutex_unlock(&fetch_req.lock);
+	return seq;
+}
+
+// ストリーミング接続が確立した(再接続ならここで取りこぼしの補完を頼む)
+void stream_established(void)
+{
+	stream_stat.connected = 1;
+	if(stream_stat.disconnected) {
+		char min_id[sizeof(newest_status_id)];
+		
+		// ここまでに表示したものより新しいもの,この後受信する分は補完が済むまで表示を待たせる
+		// 完了(RAW_RELEASE)は別のキューから届くので先に着くこともある,番号で対応を取る
+		pthread_mutex_lock(&newest_status_id_lock);
+		strcpy(min_id, newest_status_id);
+		pthread_mutex_unlock(&newest_status_id_lock);
+		push_raw_event(&raw_queue, RAW_HOLD, NULL, NULL, request_fetch(min_id));
+		
+		double outage = elapsed_since(&stream_stat.down_since);
+		
+		stream_stat.disconnected = 0;
+		atomic_store(&stream_stat.last_outage, outage);
+		stream_stat.total_outage += outage;
+		post_notice(&raw_queue, "Reconnected (#%u, outage %.1fs)", atomic_fetch_add(&stream_stat.reconnects, 1) + 1, outage);
+	}
 }
 
 // curlから呼び出されるストリーミング受信関数
@@ -189,344 +359,1247 @@ size_t streaming_callback(void* ptr, size_t size, size_t nmemb, void* data) {
 	if (size * nmemb == 0)
 		return 0;
 	
-	char **json = ((char **)data);
-	
 	size_t realsize = size * nmemb;
 	
-	size_t length = realsize + 1;
-	char *str = *json;
-	str = realloc(str, (str ? strlen(str) : 0) + length);
-	if(*((char **)data) == NULL) strcpy(str, "");
-	
-	*json = str;
-	
-	if (str != NULL) {
-		strncat(str, ptr, realsize);
-		// 改行が来たらデータ終端(一回の受信に収まるとは限らない)
-		if(str[strlen(str)-1] == 0x0a) {
-			if(*str == ':') {
-				// ':'だけは接続維持用
-				free(str);
-				*json = NULL;
-			} else {
-				streaming_received_handler();
-			}
-		}
+	if(!stream_stat.connected) stream_established();
+	
+	// 完結したイベントごとにstreaming_receivedが呼ばれる
+	if(!nano_sse_feed((struct nano_sse_parser *)data, ptr, realsize)) return 0;
+	
+	return realsize;
+}
+
+// WebSocketで受信したメッセージ,振り分けはパーススレッドで行う
+void ws_received(int opcode, char *data, size_t len, void *user)
+{
+	(void)user;
+	if(opcode != NANO_WS_TEXT) return;
+	char *copy = malloc(len + 1);
+	memcpy(copy, data, len + 1);
+	push_raw_event(&raw_queue, RAW_WS, NULL, copy, len);
+}
+
+// ストリーム名をWebSocketでの名前に直す("public/local"→"public:local")
+void ws_stream_name(const char *stream, char *buf, size_t buflen)
+{
+	if(!strcmp(stream, "local")) stream = "public:local";
+	snprintf(buf, buflen, "%s", stream);
+	for(char *p = buf; *p; p++) if(*p == '/') *p = ':';
+}
+
+// ストリームの購読を申し込む,"#tag"はハッシュタグ
+int ws_subscribe(struct nano_ws *ws, const char *stream)
+{
+	char name[256], msg[600];
+	sjson_context *ctx = sjson_create_context(0, 0, NULL);
+	
+	if(stream[0] == '#') {
+		char *tag = sjson_encode_string(ctx, stream + 1);
+		snprintf(msg, sizeof(msg), "{\"type\":\"subscribe\",\"stream\":\"hashtag\",\"tag\":%s}", tag);
+		sjson_free_string(ctx, tag);
+	} else {
+		ws_stream_name(stream, name, sizeof(name));
+		char *s = sjson_encode_string(ctx, name);
+		snprintf(msg, sizeof(msg), "{\"type\":\"subscribe\",\"stream\":%s}", s);
+		sjson_free_string(ctx, s);
 	}
+	sjson_destroy_context(ctx);
+	
+	return nano_ws_send_text(ws, msg, strlen(msg));
+}
 
-	return realsize;
+// 通知から取り出すフィールド
+enum {
+	NOTIFY_TYPE,
+	NOTIFY_ACCT,
+	NOTIFY_DISPLAY_NAME,
+	NOTIFY_STATUS,
+	NOTIFY_FIELDS
+};
+
+static const struct nano_json_field notification_fields[] = {
+	{ "type", NOTIFY_TYPE },
+	{ "account/acct", NOTIFY_ACCT },
+	{ "account/display_name", NOTIFY_DISPLAY_NAME },
+	{ "status", NOTIFY_STATUS },
+};
+
+// WebSocketのメッセージから取り出すフィールド
+enum {
+	WS_STREAM,
+	WS_EVENT,
+	WS_PAYLOAD,
+	WS_FIELDS
+};
+
+static const struct nano_json_field ws_fields[] = {
+	{ "stream", WS_STREAM },
+	{ "event", WS_EVENT },
+	{ "payload", WS_PAYLOAD },
+};
+
+// Tootのフィールド(nano_status.fieldに入る)
+static const struct nano_json_field status_fields[] = {
+	{ "id", NANO_STATUS_ID },
+	{ "created_at", NANO_STATUS_CREATED_AT },
+	{ "reblog", NANO_STATUS_REBLOG },
+	{ "content", NANO_STATUS_CONTENT },
+	{ "visibility", NANO_STATUS_VISIBILITY },
+	{ "account/acct", NANO_STATUS_ACCT },
+	{ "account/display_name", NANO_STATUS_DISPLAY_NAME },
+	{ "application/name", NANO_STATUS_APP_NAME },
+	{ "media_attachments", NANO_STATUS_MEDIA },
+};
+
+// 添付メディアの要素から取り出すフィールド
+static const struct nano_json_field media_fields[] = {
+	{ "url", 0 },
+};
+
+static struct nano_json_schema notification_schema, ws_schema, status_schema, media_schema;
+
+// フィールドの一覧をスキーマにしておく,パーススレッドの開始時に一度だけ呼ぶ
+void compile_schemas(void)
+{
+	nano_json_schema_compile(&notification_schema, notification_fields, sizeof(notification_fields) / sizeof(notification_fields[0]));
+	nano_json_schema_compile(&ws_schema, ws_fields, sizeof(ws_fields) / sizeof(ws_fields[0]));
+	nano_json_schema_compile(&status_schema, status_fields, sizeof(status_fields) / sizeof(status_fields[0]));
+	nano_json_schema_compile(&media_schema, media_fields, sizeof(media_fields) / sizeof(media_fields[0]));
 }
 
-// ストリーミングでの通知受信処理,stream_event_handlerへ代入
-void stream_event_notify(struct sjson_node *jobj_from_string)
+// JSON文字列を複製して返す(文字列でなければdefを複製)
+static char *json_strdup(struct sjson_node *node, const char *def)
 {
-	struct sjson_node *notify_type, *screen_name, *display_name, *status;
-	const char *dname;
-	if(!jobj_from_string) return;
-	read_json_fom_path(jobj_from_string, "type", &notify_type);
-	read_json_fom_path(jobj_from_string, "account/acct", &screen_name);
-	read_json_fom_path(jobj_from_string, "account/display_name", &display_name);
-	int exist_status = read_json_fom_path(jobj_from_string, "status", &status);
+	if(node && node->tag == SJSON_STRING) return strdup(node->string_);
+	return def ? strdup(def) : NULL;
+}
+
+// JSONから通知のレコードを作る,パーススレッドで呼ばれる
+// DOMは作らず,必要なフィールドだけを直接読み取る
+struct nano_notification *build_notification(sjson_context *ctx, const char *json, size_t len)
+{
+	struct nano_notification *n;
+	struct nano_json_span f[NOTIFY_FIELDS];
+	
+	if(!nano_json_scan(&notification_schema, json, len, f)) return NULL;
 	
-	putchar('\a');
+	n = calloc(1, sizeof(struct nano_notification));
+	n->type = nano_json_strdup(f[NOTIFY_TYPE], "");
+	n->acct = nano_json_strdup(f[NOTIFY_ACCT], "");
+	n->display_name = nano_json_strdup(f[NOTIFY_DISPLAY_NAME], "");
+	
+	// Follow通知だとstatusがNULLになる
+	if(nano_json_is_object(f[NOTIFY_STATUS])) {
+		n->status = build_status(ctx, f[NOTIFY_STATUS].p, f[NOTIFY_STATUS].len);
+	}
+	
+	return n;
+}
+
+// テープのrootにあるTootのレコードを作る
+// 索引と並べ替えに使うIDと日時だけを取り出し,表示するフィールドはその都度テープから読む
+static struct nano_status *status_from_tape(struct nano_tape *tape, size_t root, int borrowed)
+{
+	struct nano_status *st = calloc(1, sizeof(struct nano_status));
+	const char *created_at;
+	size_t reblog;
+	
+	st->tape = tape;
+	st->root = root;
+	st->borrowed = borrowed;
+	nano_tape_extract(&status_schema, tape, root, st->field);
+	st->id = strdup(nano_status_str(st, NANO_STATUS_ID, ""));
+	
+	created_at = nano_status_str(st, NANO_STATUS_CREATED_AT, "");
+	nano_datetime_parse(created_at, &st->created_at, &st->created_ms);
+	
+	// ブーストで回ってきた場合はブースト元も(同じテープを指す)
+	reblog = st->field[NANO_STATUS_REBLOG];
+	if(nano_tape_type(tape, reblog) == '{') {
+		st->reblog = status_from_tape(tape, reblog, 1);
+	} else {
+		// 本文のHTMLはここで1度だけ変換しておき,描き直しでは変換しない
+		const char *content = nano_status_str(st, NANO_STATUS_CONTENT, "");
+		st->content = nano_html_parse(content, strlen(content));
+	}
+	
+	return st;
+}
+
+// JSONからTootのレコードを作る,パーススレッド(とそのワーカー)で呼ばれる
+// DOMは作らず,ctxに書かせた語の列を詰め直したテープでToot全体を持つ
+struct nano_status *build_status(sjson_context *ctx, const char *json, size_t len)
+{
+	struct nano_tape *tape = nano_tape_build(ctx, json, len);
+	struct nano_status *st, *shown;
+	
+	if(!tape) return NULL;
+	if(nano_tape_type(tape, 0) != '{') {
+		free(tape);
+		return NULL;
+	}
+	st = status_from_tape(tape, 0, 0);
+	
+	// 本文は変換したもの(content)を描くので,テープからは除いて小さくしておく
+	shown = st->reblog ? st->reblog : st;
+	if(shown->content && shown->field[NANO_STATUS_CONTENT] != NANO_TAPE_NONE) {
+		tape = nano_tape_drop_str(tape, shown->field[NANO_STATUS_CONTENT]);
+		st->tape = tape;
+		if(st->reblog) st->reblog->tape = tape;
+	}
+	return st;
+}
+
+// 通知の表示,UIスレッドで呼ばれる
+void render_notification(struct nano_layout *l, struct nano_notification *n)
+{
+	const char *dname;
 	
 	// 通知種別を表示に流用するので先頭を大文字化
-	char *t = strdup(notify_type->string_);
+	char *t = strdup(n->type);
 	t[0] = toupper(t[0]);
 	
 	// 通知種別と誰からか[ screen_name(display_name) ]を表示
-	wattron(scr, COLOR_PAIR(4));
-	if(!noemojiflag) waddstr(scr, strcmp(t, "Follow") == 0 ? "👥" : strcmp(t, "Favourite") == 0 ? "💕" : strcmp(t, "Reblog") == 0 ? "🔃" : strcmp(t, "Mention") == 0 ? "🗨" : "");
-	waddstr(scr, t);
+	nano_layout_attron(l, COLOR_PAIR(4));
+	if(!noemojiflag) nano_layout_addstr(l, strcmp(t, "Follow") == 0 ? "👥" : strcmp(t, "Favourite") == 0 ? "💕" : strcmp(t, "Reblog") == 0 ? "🔃" : strcmp(t, "Mention") == 0 ? "🗨" : "");
+	nano_layout_addstr(l, t);
 	free(t);
-	waddstr(scr, " from ");
-	waddstr(scr, screen_name->string_);
+	nano_layout_addstr(l, " from ");
+	nano_layout_addstr(l, n->acct);
 	
-	dname = display_name->string_;
+	dname = n->display_name;
 	
 	// dname(display_name)が空の場合は括弧を表示しない
 	if (dname[0] != '\0') {
-		wprintw(scr, " (%s)", dname);
+		nano_layout_printf(l, " (%s)", dname);
 	}
-	waddstr(scr, "\n");
-	wattroff(scr, COLOR_PAIR(4));
+	nano_layout_addstr(l, "\n");
+	nano_layout_attroff(l, COLOR_PAIR(4));
 	
-	sjson_tag type;
+	// 通知対象のTootを表示
+	if(n->status) {
+		render_status(l, n->status);
+	}
 	
-	type = status->tag;
+	nano_layout_addstr(l, "\n");
+}
+
+// 本文の文字列の種類ごとの属性
+static const uint32_t content_attr[] = {
+	[NANO_HTML_TEXT] = 0,
+	[NANO_HTML_LINK] = A_UNDERLINE,
+	[NANO_HTML_MENTION] = COLOR_PAIR(1),
+	[NANO_HTML_HASHTAG] = COLOR_PAIR(3),
+};
+
+// Tootの表示,UIスレッドで呼ばれる
+#define DATEBUFLEN	40
+void render_status(struct nano_layout *l, struct nano_status *st)
+{
+	const char *sname, *dname, *vstr;
+	char datebuf[DATEBUFLEN];
+	int x, date_w;
+	nano_datetime_format(datebuf, sizeof(datebuf), st->created_at);
+	
+	vstr = nano_status_str(st, NANO_STATUS_VISIBILITY, "public");
 	
-	// 通知対象のTootを表示,Follow通知だとtypeがNULLになる
-	if(type != SJSON_NULL && exist_status) {
-		stream_event_update(status);
+	if(hidlckflag) {
+		if(!strcmp(vstr, "private") || !strcmp(vstr, "direct")) {
+			return;
+		}
 	}
 	
-	waddstr(scr, "\n");
-	wrefresh(scr);
+	sname = nano_status_str(st, NANO_STATUS_ACCT, "");
+	dname = nano_status_str(st, NANO_STATUS_DISPLAY_NAME, "");
 	
-	wmove(pad, pad_x, pad_y);
-	wrefresh(pad);
+	// ブーストで回ってきた場合はその旨を表示
+	if(st->reblog) {
+		nano_layout_attron(l, COLOR_PAIR(3));
+		if(!noemojiflag) nano_layout_addstr(l, "🔃 ");
+		nano_layout_addstr(l, "Reblog by ");
+		nano_layout_addstr(l, sname);
+		// dname(表示名)が空の場合は括弧を表示しない
+		if (dname[0] != '\0') nano_layout_printf(l, " (%s)", dname);
+		nano_layout_addstr(l, "\n");
+		nano_layout_attroff(l, COLOR_PAIR(3));
+		render_status(l, st->reblog);
+		return;
+	}
+	
+	// 誰からか[ screen_name(display_name) ]を表示
+	nano_layout_attron(l, COLOR_PAIR(1)|A_BOLD);
+	nano_layout_addstr(l, sname);
+	nano_layout_attroff(l, COLOR_PAIR(1)|A_BOLD);
+	
+	// dname(表示名)が空の場合は括弧を表示しない
+	if (dname[0] != '\0') {
+		nano_layout_attron(l, COLOR_PAIR(2));
+		nano_layout_printf(l, " (%s)", dname);
+		nano_layout_attroff(l, COLOR_PAIR(2));
+	}
+	
+	if(strcmp(vstr, "public")) {
+		int vtyp = strcmp(vstr, "unlisted");
+		nano_layout_attron(l, COLOR_PAIR(3)|A_BOLD);
+		nano_layout_addstr(l, " ");
+		if(noemojiflag) {
+			if(!strcmp(vstr, "unlisted")) {
+				nano_layout_addstr(l, "<UNLIST>");
+			} else if(!strcmp(vstr, "private")) {
+				nano_layout_addstr(l, "<PRIVATE>");
+			} else {
+				nano_layout_addstr(l, "<!DIRECT!>");
+			}
+		} else {
+			if(!strcmp(vstr, "unlisted")) {
+				nano_layout_addstr(l, "🔓");
+			} else if(!strcmp(vstr, "private")) {
+				nano_layout_addstr(l, "🔒");
+			} else {
+				nano_layout_addstr(l, "✉");
+			}
+		}
+		nano_layout_attroff(l, COLOR_PAIR(3)|A_BOLD);
+	}
+	
+	// 日付表示
+	date_w = nano_str_width(datebuf) + 1;
+	x = nano_layout_x(l);
+	if (x < term_w - date_w) {
+		nano_layout_move_x(l, term_w - date_w);
+	} else {
+		// 入りきらなければ名前の後ろを削る
+		nano_layout_move_x(l, term_w - date_w - 1);
+		nano_layout_addstr(l, " ");
+	}
+	nano_layout_attron(l, COLOR_PAIR(5));
+	nano_layout_addstr(l, datebuf);
+	nano_layout_attroff(l, COLOR_PAIR(5));
+	nano_layout_addstr(l, "\n");
+	
+	// 本文(リンク・メンション・ハッシュタグは色を変える)
+	if(st->content) {
+		for(size_t i = 0; i < st->content->nspans; i++) {
+			const struct nano_html_span *sp = &st->content->spans[i];
+			uint32_t attr = content_attr[sp->style];
+			nano_layout_attron(l, attr);
+			nano_layout_addnstr(l, st->content->text + sp->off, sp->len);
+			nano_layout_attroff(l, attr);
+		}
+	}
+	
+	nano_layout_addstr(l, "\n");
+	
+	// 添付メディアのURL表示
+	size_t media = st->field[NANO_STATUS_MEDIA];
+	for(size_t m = nano_tape_child(st->tape, media); m != NANO_TAPE_NONE; m = nano_tape_next(st->tape, media, m)) {
+		size_t url_field;
+		nano_tape_extract(&media_schema, st->tape, m, &url_field);
+		const char *url = nano_tape_str(st->tape, url_field, NULL);
+		if(!url) continue;
+		nano_layout_addstr(l, noemojiflag ? "<LINK>" : "🔗");
+		nano_layout_addstr(l, url);
+		nano_layout_addstr(l, "\n");
+	}
+	
+	// 投稿アプリ名表示(名前が取れたときのみ)
+	const char *app_name = nano_status_str(st, NANO_STATUS_APP_NAME, NULL);
+	if(app_name) {
+		int w = nano_str_width(app_name);
+		
+		// 右寄せにするために空白を並べる
+		nano_layout_move_x(l, term_w - (w + 4 + 1));
+		
+		nano_layout_attron(l, COLOR_PAIR(1));
+		nano_layout_addstr(l, "via ");
+		nano_layout_attroff(l, COLOR_PAIR(1));
+		nano_layout_attron(l, COLOR_PAIR(2));
+		nano_layout_addstr(l, app_name);
+		nano_layout_addstr(l, "\n");
+		nano_layout_attroff(l, COLOR_PAIR(2));
+	}
+	
+	nano_layout_addstr(l, "\n");
+}
+
+// ストリーミングで受信したイベント(dataは受信バッファ内を指しているので複製して渡す)
+void streaming_received(struct nano_sse_event *ev, void *user)
+{
+	(void)user;
+	char *data = malloc(ev->data_len + 1);
+	memcpy(data, ev->data, ev->data_len + 1);
+	push_raw_event(&raw_queue, RAW_STREAM, ev->type, data, ev->data_len);
+}
+
+// パーススレッドの状態
+struct nano_seen seen_ids;		// 表示したToot ID
+struct nano_intern stream_names;	// ストリーム名(レコードはここを指すだけで解放しない)
+unsigned int hold_seq = 1;		// 受け取ったRAW_HOLDの番号の最大(起動時の取得の分で1)
+unsigned int released_seq;		// 取得が済んだ依頼の番号,hold_seqに追いつくまでストリーミングの分は溜めておく
+struct nano_record **held_records;	// その間に受信したストリーミングの分
+size_t held_count, held_cap;
+int parsing_stream;			// パース中のイベントがストリーミングで受信したものか
+
+// 溜めておいたストリーミングの分をUIスレッドへ渡す
+// 取得したページで表示済みになったTootはここで捨てる(ページの方を先に,順番どおりに出すため)
+void flush_held_records(void)
+{
+	for(size_t i = 0; i < held_count; i++) {
+		struct nano_record *rec = held_records[i];
+		if(rec->kind == NANO_RECORD_STATUS && !nano_seen_add(&seen_ids, nano_status_key(rec->status->id))) {
+			nano_record_free(rec);
+			continue;
+		}
+		nano_queue_push(&ui_queue, rec);
+	}
+	held_count = 0;
+}
+
+// パースしたレコードをUIスレッドへ渡す(streamは追加購読したストリームの名前)
+// 既に表示したTootは捨てる,タイムライン取得中ならストリーミングの分は取得が済むまで溜めておく
+void push_record(enum nano_record_kind kind, void *ptr, const char *stream)
+{
+	struct nano_record *rec;
+	int hold = parsing_stream && released_seq < hold_seq;
+	
+	if(!ptr) return;
+	// 溜める分の重複はflush_held_recordsで確かめる
+	if(kind == NANO_RECORD_STATUS && !hold && !nano_seen_add(&seen_ids, nano_status_key(((struct nano_status *)ptr)->id))) {
+		nano_status_free(ptr);
+		return;
+	}
+	rec = malloc(sizeof(struct nano_record));
+	rec->kind = kind;
+	rec->stream = stream ? nano_intern(&stream_names, stream) : NULL;
+	switch(kind) {
+	case NANO_RECORD_STATUS:
+	case NANO_RECORD_EDIT:
+		rec->status = ptr;
+		break;
+	case NANO_RECORD_NOTIFICATION:
+		rec->notify = ptr;
+		break;
+	case NANO_RECORD_NOTICE:
+		rec->notice = ptr;
+		break;
+	case NANO_RECORD_DELETE:
+		rec->deleted_id = ptr;
+		break;
+	}
+	
+	if(hold) {
+		// 溜めすぎたら(取得が終わらないなど)諦めて先に出す
+		if(held_count >= HELD_RECORDS_MAX) flush_held_records();
+		if(held_count >= held_cap) {
+			held_cap = held_cap ? held_cap * 2 : 64;
+			held_records = realloc(held_records, sizeof(struct nano_record *) * held_cap);
+		}
+		held_records[held_count++] = rec;
+		return;
+	}
+	nano_queue_push(&ui_queue, rec);
+}
+
+// 新しいToot
+static void stream_event_update(sjson_context *ctx, char *data, const char *stream)
+{
+	struct nano_status *st = build_status(ctx, data, strlen(data));
+	if(!st) return;
+	if(!stream) note_status_id(st);
+	push_record(NANO_RECORD_STATUS, st, stream);
+}
+
+// 編集されたToot
+static void stream_event_status_update(sjson_context *ctx, char *data, const char *stream)
+{
+	push_record(NANO_RECORD_EDIT, build_status(ctx, data, strlen(data)), stream);
+}
+
+// 削除されたToot,dataはJSONではなくIDそのもの
+static void stream_event_delete(sjson_context *ctx, char *data, const char *stream)
+{
+	(void)ctx;
+	size_t n = strspn(data, "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ");
+	if(n == 0) return;
+	push_record(NANO_RECORD_DELETE, strndup(data, n), stream);
+}
+
+// 通知
+static void stream_event_notification(sjson_context *ctx, char *data, const char *stream)
+{
+	push_record(NANO_RECORD_NOTIFICATION, build_notification(ctx, data, strlen(data)), stream);
+}
+
+// サーバからのお知らせ,本文のタグは取り除いてお知らせ欄に出す
+static void stream_event_announcement(sjson_context *ctx, char *data, const char *stream)
+{
+	struct sjson_node *jobj_from_string = sjson_decode_insitu(ctx, data);
+	if(!jobj_from_string) return;
+	char *content = json_strdup(sjson_find_member(jobj_from_string, "content"), "");
+	char *text = malloc(strlen(content) + 16);
+	char *d = text + sprintf(text, "Announcement: ");
+	int ltgt = 0;
+	for(const char *p = content; *p; p++) {
+		if(*p == '<') ltgt = 1;
+		else if(*p == '>') ltgt = 0;
+		else if(!ltgt) *d++ = *p == '\n' ? ' ' : *p;
+	}
+	*d = 0;
+	free(content);
+	push_record(NANO_RECORD_NOTICE, text, stream);
+}
+
+// 表示するものが無いイベント
+static void stream_event_ignore(sjson_context *ctx, char *data, const char *stream)
+{
+	(void)ctx;
+	(void)data;
+	(void)stream;
+}
+
+// ストリーミングのイベント種別ごとの処理
+static const struct {
+	const char *type;
+	void (*func)(sjson_context *ctx, char *data, const char *stream);
+} stream_events[] = {
+	{ "update", stream_event_update },
+	{ "status.update", stream_event_status_update },
+	{ "delete", stream_event_delete },
+	{ "notification", stream_event_notification },
+	{ "announcement", stream_event_announcement },
+	{ "announcement.reaction", stream_event_ignore },
+	{ "announcement.delete", stream_event_ignore },
+	{ "conversation", stream_event_ignore },	// DMはupdateでも届く
+	{ "filters_changed", stream_event_ignore },
+	{ "notifications_merged", stream_event_ignore },
+	{ "encrypted_message", stream_event_ignore },
+};
+
+// ストリーミングのイベントをパースしてレコードにする
+// dataはその場でデコードするので書き換わる
+void parse_stream_event(sjson_context *ctx, const char *type, char *data, const char *stream)
+{
+	for(size_t i = 0; i < sizeof(stream_events) / sizeof(stream_events[0]); i++) {
+		if(!strcmp(type, stream_events[i].type)) {
+			stream_events[i].func(ctx, data, stream);
+			return;
+		}
+	}
+}
+
+// WebSocketのメッセージを購読ストリームごとに振り分ける
+// {"stream":["hashtag","foo"],"event":"update","payload":"{...}"}
+// payloadはdataの中でエスケープを戻すのでコピーしない
+void parse_ws_message(sjson_context *ctx, char *data)
+{
+	struct sjson_node *msg = sjson_decode_insitu(ctx, data);
+	struct sjson_node *f[WS_FIELDS], *stream, *event, *payload;
+	char label[256], primary[256];
+	
+	if(!msg || msg->tag != SJSON_OBJECT) return;
+	nano_json_extract(&ws_schema, msg, f);
+	stream = f[WS_STREAM];
+	event = f[WS_EVENT];
+	payload = f[WS_PAYLOAD];
+	if(!event || event->tag != SJSON_STRING || !payload || payload->tag != SJSON_STRING) return;
+	
+	// 表示用のストリーム名,ハッシュタグは"#tag"にする
+	label[0] = 0;
+	if(stream && stream->tag == SJSON_ARRAY) {
+		struct sjson_node *name = sjson_find_element(stream, 0);
+		struct sjson_node *param = sjson_find_element(stream, 1);
+		if(name && name->tag == SJSON_STRING) {
+			if(!strncmp(name->string_, "hashtag", 7) && param && param->tag == SJSON_STRING) {
+				snprintf(label, sizeof(label), "#%s", param->string_);
+			} else if(param && param->tag == SJSON_STRING) {
+				snprintf(label, sizeof(label), "%s:%s", name->string_, param->string_);
+			} else {
+				snprintf(label, sizeof(label), "%s", name->string_);
+			}
+		}
+	}
+	
+	// メインのタイムライン(とその通知)はラベルを付けない
+	ws_stream_name(selected_stream, primary, sizeof(primary));
+	if(!label[0] || !strcmp(label, primary) || !strncmp(label, "user", 4)) {
+		parse_stream_event(ctx, event->string_, payload->string_, NULL);
+	} else {
+		parse_stream_event(ctx, event->string_, payload->string_, label);
+	}
+}
+
+// 使い回すsjsonのコンテキストとその確保先
+// イベントごとにsjson_reset_contextで空にするだけなので,落ち着けばmallocしない
+struct json_workspace {
+	struct nano_arena arena;
+	sjson_context *ctx;
+	size_t payload;		// ctxが想定しているペイロード長
+};
+
+// パーススレッドとタイムラインのワーカーがそれぞれ持つ
+static _Thread_local struct json_workspace parse_json;
+
+// payloadバイトのJSONが収まるようにctxとarenaを作り直す
+// ノードはおよそ16バイトに1つ,文字列はその場でデコードするので文字列ページは索引の表とページの切れ端の分
+// テープの語は8バイトに1つ,伸ばすときに古い分が残るのでその倍
+static void json_workspace_rebuild(struct json_workspace *w, size_t payload)
+{
+	int nodes = (int)(payload / 16);
+	size_t size = sizeof(sjson_context)
+		+ sizeof(sjson__node_page) + (sizeof(sjson_node) + sizeof(sjson_node *)) * (nodes + 16)
+		+ (sizeof(sjson__str_page) + 64) * 4 + payload * 2
+		+ sizeof(uint64_t) * (payload / 8 + 16) * 2;
+	
+	if(w->ctx) sjson_destroy_context(w->ctx);
+	w->ctx = NULL;
+	if(!nano_arena_reset(&w->arena, size)) return;
+	w->ctx = sjson_create_context(nodes, (int)payload, &w->arena);
+	if(w->ctx) {
+		sjson_index_arrays(w->ctx, true);
+		sjson_index_objects(w->ctx, true);
+	}
+	w->payload = payload;
+}
+
+// lenバイトのJSONを読むコンテキストを返す
+static sjson_context *json_workspace_begin(struct json_workspace *w, size_t len)
+{
+	if(len > JSON_PAYLOAD_MAX) return sjson_create_context(0, 0, NULL);
+	
+	// 想定より大きいものが来たか,arenaからはみ出したら大きくする
+	if(!w->ctx || len > w->payload || w->arena.overflow) {
+		size_t payload = w->payload ? w->payload : JSON_PAYLOAD_MIN;
+		if(w->arena.overflow) payload *= 2;
+		while(payload < len) payload *= 2;
+		if(payload > JSON_PAYLOAD_MAX) payload = JSON_PAYLOAD_MAX;
+		json_workspace_rebuild(w, payload);
+	}
+	
+	return w->ctx ? w->ctx : sjson_create_context(0, 0, NULL);
+}
+
+static void json_workspace_end(struct json_workspace *w, sjson_context *ctx)
+{
+	if(ctx == w->ctx) {
+		sjson_reset_context(ctx);
+	} else {
+		sjson_destroy_context(ctx);
+	}
+}
+
+// タイムラインのページを読むワーカー(パーススレッドが持つ)
+static struct nano_pool parse_pool;
+
+struct timeline_job {
+	const struct nano_json_span *items;
+	struct nano_status **statuses;
+};
+
+static void timeline_decode(void *arg, size_t i)
+{
+	struct timeline_job *job = arg;
+	sjson_context *ctx = json_workspace_begin(&parse_json, job->items[i].len);
+	job->statuses[i] = build_status(ctx, job->items[i].p, job->items[i].len);
+	json_workspace_end(&parse_json, ctx);
+}
+
+// REST APIで取得したタイムライン(Tootの配列)をレコードにする
+// 要素の範囲を先に拾ってワーカーで並列にデコードし,元の順番でレコードにする
+void parse_timeline(const char *json, size_t len)
+{
+	struct nano_json_span page = { json, len }, *items = NULL, item;
+	struct nano_json_iter it;
+	struct timeline_job job;
+	size_t count = 0, cap = 0;
+	
+	while(len > 0 && isspace((unsigned char)*page.p)) {
+		page.p++;
+		page.len--;
+		len--;
+	}
+	if(!nano_json_array_begin(&it, page)) return;
+	
+	// 要素の範囲を拾っておく
+	while(nano_json_array_next(&it, &item)) {
+		if(count >= cap) {
+			cap = cap ? cap * 2 : 64;
+			items = realloc(items, sizeof(struct nano_json_span) * cap);
+		}
+		items[count++] = item;
+	}
+	
+	job.items = items;
+	job.statuses = malloc(sizeof(struct nano_status *) * (count ? count : 1));
+	if(count >= PARALLEL_DECODE_MIN) {
+		nano_pool_for(&parse_pool, count, timeline_decode, &job);
+	} else {
+		for(size_t i = 0; i < count; i++) timeline_decode(&job, i);
+	}
+	
+	// 新しい順に並んでいるので古い方から
+	while(count > 0) {
+		struct nano_status *st = job.statuses[--count];
+		if(!st) continue;
+		note_status_id(st);
+		push_record(NANO_RECORD_STATUS, st, NULL);
+	}
+	free(job.statuses);
+	free(items);
+}
+
+// 生のイベントをパースしてレコードにする
+void parse_raw_event(struct raw_event *ev)
+{
+	parsing_stream = ev->kind == RAW_STREAM || ev->kind == RAW_WS;
+	
+	switch(ev->kind) {
+	case RAW_NOTICE:
+		push_record(NANO_RECORD_NOTICE, ev->data, NULL);
+		ev->data = NULL;
+		return;
+	case RAW_HOLD:
+		if(ev->len > hold_seq) hold_seq = ev->len;
+		return;
+	case RAW_RELEASE:
+		// 取得した分は表示済みなので,溜めておいた分のうち重複していないものを続けて出す
+		// 対応するRAW_HOLDより先に届いていれば,そのRAW_HOLDでは溜めない
+		if(ev->len > released_seq) released_seq = ev->len;
+		if(released_seq >= hold_seq) flush_held_records();
+		return;
+	default:
+		break;
+	}
+	
+	if(ev->kind == RAW_TIMELINE) {
+		parse_timeline(ev->data, ev->len);
+		return;
+	}
+	
+	sjson_context* ctx = json_workspace_begin(&parse_json, ev->len);
+	
+	if(ev->kind == RAW_WS) {
+		parse_ws_message(ctx, ev->data);
+	} else {
+		parse_stream_event(ctx, ev->type, ev->data, NULL);
+	}
+	
+	json_workspace_end(&parse_json, ctx);
+}
+
+// キューのイベントを全てパースする
+static void parse_queued_events(struct nano_queue *q)
+{
+	struct raw_event *ev;
+	
+	while((ev = nano_queue_pop(q)) != NULL) {
+		uint64_t t = nano_queue_now();
+		parse_raw_event(ev);
+		stage_stat_add(&parse_stat, nano_queue_now() - t);
+		free(ev->data);
+		free(ev);
+	}
+}
+
+// パーススレッド,ストリーミングとタイムライン取得の両方から受け取る
+void *parse_thread_func(void *param)
+{
+	struct pollfd fds[2];
+	(void)param;
+	
+	nano_seen_init(&seen_ids, SEEN_IDS_MAX);
+	nano_intern_init(&stream_names, 16);
+	compile_schemas();
+	nano_pool_init(&parse_pool, parse_threads > 0 ? parse_threads : nano_pool_cpus(PARSE_THREADS_MAX));
+	
+	fds[0].fd = nano_queue_fd(&raw_queue);
+	fds[0].events = POLLIN;
+	fds[1].fd = nano_queue_fd(&rest_queue);
+	fds[1].events = POLLIN;
+	
+	while(1) {
+		if(nano_queue_depth(&raw_queue) == 0 && nano_queue_depth(&rest_queue) == 0) {
+			poll(fds, 2, -1);
+		}
+		nano_queue_drain_wake(&raw_queue);
+		nano_queue_drain_wake(&rest_queue);
+		
+		parse_queued_events(&raw_queue);
+		parse_queued_events(&rest_queue);
+	}
+	
+	return NULL;
+}
+
+// タイムラインにお知らせを1行表示する
+void render_notice(struct nano_layout *l, const char *text)
+{
+	nano_layout_attron(l, COLOR_PAIR(4));
+	nano_layout_addstr(l, text);
+	nano_layout_addstr(l, "\n");
+	nano_layout_attroff(l, COLOR_PAIR(4));
+}
+
+// レコードを1件レイアウトに描く
+void render_record(struct nano_layout *l, struct nano_record *rec)
+{
+	// 追加購読したストリームから来たものはストリーム名を添える
+	if(rec->stream) {
+		nano_layout_attron(l, COLOR_PAIR(5));
+		nano_layout_printf(l, "[%s] ", rec->stream);
+		nano_layout_attroff(l, COLOR_PAIR(5));
+	}
+	
+	switch(rec->kind) {
+	case NANO_RECORD_STATUS:
+		render_status(l, rec->status);
+		break;
+	case NANO_RECORD_NOTIFICATION:
+		render_notification(l, rec->notify);
+		break;
+	case NANO_RECORD_NOTICE:
+		render_notice(l, rec->notice);
+		break;
+	default:
+		break;
+	}
+}
+
+// タイムラインのどこを表示しているか
+// 下端の行で覚えておくので,上へ戻っている間に新着が来ても表示は動かない
+struct timeline_view {
+	int follow;		// 最新に追従している(新着が来たら下端に出す)
+	size_t bottom;		// 下端の行を含むエントリの通し番号
+	int bottom_row;		// そのエントリの何行目が下端か
+	int full;		// 最後に描き直したとき画面が埋まっていた(新着は下に足すだけでよい)
+} view = { 1, 0, 0, 0 };
+
+// エントリの今の幅でのレイアウト(幅が変わったか差し替えられていれば作り直す)
+static struct nano_layout *entry_layout(struct nano_timeline_entry *e)
+{
+	if(e->layout.width != term_w) {
+		nano_layout_begin(&e->layout, term_w);
+		render_record(&e->layout, e->rec);
+		nano_layout_end(&e->layout);
+	}
+	return &e->layout;
+}
+
+// 1行上へ,動けなければ0を返す(行の無いエントリは飛ばす)
+static int row_up(struct nano_timeline_entry **e, int *row)
+{
+	struct nano_timeline_entry *p = *e;
+	
+	if(*row > 0) {
+		(*row)--;
+		return 1;
+	}
+	while((p = nano_timeline_prev(&timeline, p)) != NULL) {
+		if(entry_layout(p)->nrows > 0) {
+			*e = p;
+			*row = p->layout.nrows - 1;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// 1行下へ,動けなければ0を返す
+static int row_down(struct nano_timeline_entry **e, int *row)
+{
+	struct nano_timeline_entry *n = *e;
+	
+	if(*row + 1 < entry_layout(n)->nrows) {
+		(*row)++;
+		return 1;
+	}
+	while((n = nano_timeline_next(&timeline, n)) != NULL) {
+		if(entry_layout(n)->nrows > 0) {
+			*e = n;
+			*row = 0;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// 下端の行(表示するものが無ければNULL)
+static struct nano_timeline_entry *view_bottom(int *row)
+{
+	struct nano_timeline_entry *e;
+	
+	if(view.follow) {
+		e = nano_timeline_newest(&timeline);
+		*row = INT_MAX;
+	} else {
+		// 捨てたか消したエントリなら,その次から
+		e = nano_timeline_seek(&timeline, view.bottom);
+		*row = e && nano_timeline_serial(&timeline, e) == view.bottom ? view.bottom_row : 0;
+	}
+	if(!e) return NULL;
+	
+	// 行が減っていれば最後の行に,行が無ければ前の行へ
+	if(*row >= entry_layout(e)->nrows) *row = e->layout.nrows - 1;
+	if(*row < 0) {
+		*row = 0;
+		if(!row_up(&e, row)) return NULL;
+	}
+	return e;
+}
+
+// 上端が(e, row)になるように表示位置を決める(最新の行まで届けば追従に戻す)
+static void view_set_top(struct nano_timeline_entry *e, int row)
+{
+	int rows = getmaxy(scr);
+	
+	for(int i = 1; i < rows; i++) {
+		if(!row_down(&e, &row)) break;
+	}
+	view.bottom = nano_timeline_serial(&timeline, e);
+	view.bottom_row = row;
+	view.follow = !row_down(&e, &row);
+}
+
+// n行スクロールする(正なら古い方へ)
+void view_scroll(int n)
+{
+	struct nano_timeline_entry *e;
+	int row, rows = getmaxy(scr);
+	
+	if(!(e = view_bottom(&row))) return;
+	for(int i = 1; i < rows; i++) row_up(&e, &row);
+	
+	for(; n > 0 && row_up(&e, &row); n--);
+	for(; n < 0 && row_down(&e, &row); n++);
+	view_set_top(e, row);
+}
+
+// 最も古い行へ
+void view_home(void)
+{
+	struct nano_timeline_entry *e = nano_timeline_oldest(&timeline);
+	int row = 0;
+	
+	if(!e) return;
+	if(entry_layout(e)->nrows == 0 && !row_down(&e, &row)) return;
+	view_set_top(e, row);
+}
+
+// 最新に戻る
+void view_end(void)
+{
+	view.follow = 1;
 }
 
-// ストリーミングでのToot受信処理,stream_event_handlerへ代入
-#define DATEBUFLEN	40
-void stream_event_update(struct sjson_node *jobj_from_string)
+// レイアウトの1行をWindowのy行目に描く
+// runごとに1回のwaddnstrで出し,属性は変わるときだけ設定する(*attrは今の属性)
+static void paint_row(struct nano_layout *l, int row, int y, uint32_t *attr)
 {
-	struct sjson_node *content, *screen_name, *display_name, *reblog, *visibility;
-	const char *sname, *dname, *vstr;
-	struct sjson_node *created_at;
-	struct tm tm;
-	time_t time;
-	char datebuf[DATEBUFLEN];
-	int x, y, date_w;
-	if(!jobj_from_string) return;
-	read_json_fom_path(jobj_from_string, "content", &content);
-	read_json_fom_path(jobj_from_string, "account/acct", &screen_name);
-	read_json_fom_path(jobj_from_string, "account/display_name", &display_name);
-	read_json_fom_path(jobj_from_string, "reblog", &reblog);
-	read_json_fom_path(jobj_from_string, "created_at", &created_at);
-	read_json_fom_path(jobj_from_string, "visibility", &visibility);
-	memset(&tm, 0, sizeof(tm));
-	strptime(created_at->string_, "%Y-%m-%dT%H:%M:%S", &tm);
-	time = timegm(&tm);
-	strftime(datebuf, sizeof(datebuf), "%x(%a) %X", localtime(&time));
-	
-	vstr = visibility->string_;
-	
-	if(hidlckflag) {
-		if(!strcmp(vstr, "private") || !strcmp(vstr, "direct")) {
-			return;
+	const struct nano_layout_row *r = &l->rows[row];
+	
+	if(r->start == r->end) return;
+	wmove(scr, y, 0);
+	for(size_t i = r->run; i < l->nruns && l->runs[i].off < r->end; i++) {
+		const struct nano_layout_run *run = &l->runs[i];
+		size_t start = run->off > r->start ? run->off : r->start;
+		size_t end = run->off + run->len < r->end ? run->off + run->len : r->end;
+		if(start >= end) continue;
+		if(run->attr != *attr) {
+			wattrset(scr, run->attr);
+			*attr = run->attr;
 		}
+		waddnstr(scr, l->text + start, (int)(end - start));
 	}
-	
-	sjson_tag type;
-	
-	type = reblog->tag;
-	sname = screen_name->string_;
-	dname = display_name->string_;
-	
-	// ブーストで回ってきた場合はその旨を表示
-	if(type != SJSON_NULL) {
-		wattron(scr, COLOR_PAIR(3));
-		if(!noemojiflag) waddstr(scr, "🔃 ");
-		waddstr(scr, "Reblog by ");
-		waddstr(scr, sname);
-		// dname(表示名)が空の場合は括弧を表示しない
-		if (dname[0] != '\0') wprintw(scr, " (%s)", dname);
-		waddstr(scr, "\n");
-		wattroff(scr, COLOR_PAIR(3));
-		stream_event_update(reblog);
-		return;
+}
+
+// 保持しているレコードからWindowを描き直す
+// 下端から画面の行数分だけ遡って上から描くので,保持している件数によらず画面の行数分で済む
+void render_repaint(void)
+{
+	struct nano_timeline_entry *e, *bottom;
+	int row, bottom_row, rows = getmaxy(scr);
+	uint32_t attr = A_NORMAL;
+	
+	wattrset(scr, A_NORMAL);
+	werase(scr);
+	if(!(bottom = e = view_bottom(&row))) return;
+	bottom_row = row;
+	for(int i = 1; i < rows; i++) {
+		if(!row_up(&e, &row)) break;
 	}
 	
-	// 誰からか[ screen_name(display_name) ]を表示
-	wattron(scr, COLOR_PAIR(1)|A_BOLD);
-	waddstr(scr, sname);
-	wattroff(scr, COLOR_PAIR(1)|A_BOLD);
-	
-	// dname(表示名)が空の場合は括弧を表示しない
-	if (dname[0] != '\0') {
-		wattron(scr, COLOR_PAIR(2));
-		wprintw(scr, " (%s)", dname);
-		wattroff(scr, COLOR_PAIR(2));
+	view.full = 0;
+	for(int y = 0; y < rows; y++) {
+		paint_row(&e->layout, row, y, &attr);
+		if(y == rows - 1) view.full = 1;
+		if(e == bottom && row == bottom_row) break;
+		if(!row_down(&e, &row)) break;
 	}
+	wattrset(scr, A_NORMAL);
+}
+
+// 最新に追従していて画面が埋まっていれば,追加したエントリの分だけ上へずらして下に描く
+// 描き直しが要れば0を返す
+static int render_append(struct nano_timeline_entry *e)
+{
+	struct nano_layout *l;
+	int rows = getmaxy(scr);
+	uint32_t attr = A_NORMAL;
+	
+	if(!view.follow || !view.full) return 0;
+	l = entry_layout(e);
+	if(l->nrows >= rows) return 0;
+	if(l->nrows == 0) return 1;
+	
+	scrollok(scr, TRUE);
+	wscrl(scr, l->nrows);
+	scrollok(scr, FALSE);
+	wattrset(scr, A_NORMAL);
+	for(int row = 0; row < l->nrows; row++) paint_row(l, row, rows - l->nrows + row, &attr);
+	wattrset(scr, A_NORMAL);
+	return 1;
+}
+
+// 表示済みのTootの削除と編集を反映する,描き直しが要れば1を返す
+int apply_record(struct nano_record *rec)
+{
+	struct nano_timeline_entry *e;
+	int changed = 0;
 	
-	if(strcmp(vstr, "public")) {
-		int vtyp = strcmp(vstr, "unlisted");
-		wattron(scr, COLOR_PAIR(3)|A_BOLD);
-		waddstr(scr, " ");
-		if(noemojiflag) {
-			if(!strcmp(vstr, "unlisted")) {
-				waddstr(scr, "<UNLIST>");
-			} else if(!strcmp(vstr, "private")) {
-				waddstr(scr, "<PRIVATE>");
-			} else {
-				waddstr(scr, "<!DIRECT!>");
-			}
-		} else {
-			if(!strcmp(vstr, "unlisted")) {
-				waddstr(scr, "🔓");
-			} else if(!strcmp(vstr, "private")) {
-				waddstr(scr, "🔒");
-			} else {
-				waddstr(scr, "✉");
-			}
+	if(rec->kind == NANO_RECORD_DELETE) {
+		while((e = nano_timeline_find(&timeline, rec->deleted_id, NULL)) != NULL) {
+			nano_timeline_remove(&timeline, e);
+			changed = 1;
 		}
-		wattroff(scr, COLOR_PAIR(3)|A_BOLD);
-	}
-	
-	// 日付表示
-	date_w = ustrwidth(datebuf) + 1;
-	getyx(scr, y, x);
-	if (x < term_w - date_w) {
-		for(int i = 0; i < term_w - x - date_w; i++) waddstr(scr, " ");
 	} else {
-		for(int i = 0; i < x - (term_w - date_w); i++) waddstr(scr, "\b");
-		waddstr(scr, "\b ");
+		for(e = nano_timeline_find(&timeline, rec->status->id, NULL); e; e = nano_timeline_find(&timeline, rec->status->id, e)) {
+			nano_timeline_replace(&timeline, e, nano_status_dup(rec->status));
+			changed = 1;
+		}
 	}
-	wattron(scr, COLOR_PAIR(5));
-	waddstr(scr, datebuf);
-	wattroff(scr, COLOR_PAIR(5));
-	waddstr(scr, "\n");
-	
-	const char *src = content->string_;
 	
-	/*waddstr(scr, src);
-	waddstr(scr, "\n");*/
+	return changed;
+}
+
+// パース済みのレコードを全てWindowに描く,UIスレッドで呼ばれる
+// 端末への出力はrender_flushでまとめて行う
+void render_pending_records(void)
+{
+	struct nano_record *rec;
+	uint64_t n = 0;
+	int repaint = 0, changed = 0;
 	
-	// タグ消去処理、2個目以降のの<p>は改行に
-	int ltgt = 0;
-	int pcount = 0;
-	while(*src) {
-		// タグならタグフラグを立てる
-		if(*src == '<') ltgt = 1;
+	while((rec = nano_queue_pop(&ui_queue)) != NULL) {
+		uint64_t t = nano_queue_now();
 		
-		if(ltgt && strncmp(src, "<br", 3) == 0) waddch(scr, '\n');
-		if(ltgt && strncmp(src, "<p", 2) == 0) {
-			pcount++;
-			if(pcount >= 2) {
-				waddstr(scr, "\n\n");
-			}
+		if(rec->kind == NANO_RECORD_DELETE || rec->kind == NANO_RECORD_EDIT) {
+			if(apply_record(rec)) repaint = 1;
+			nano_record_free(rec);
+		} else {
+			if(rec->kind == NANO_RECORD_NOTIFICATION) putchar('\a');
+			nano_timeline_append(&timeline, rec);
+			// 最新を表示していれば下に足す,上へ戻っている間は持っておくだけ
+			if(view.follow && !repaint && !render_append(nano_timeline_newest(&timeline))) repaint = 1;
+			if(view.follow) changed = 1;
 		}
 		
-		// タグフラグが立っていない(=通常文字)とき
-		if(!ltgt) {
-			// 文字実体参照の処理
-			if(*src == '&') {
-				if(strncmp(src, "&amp;", 5) == 0) {
-					waddch(scr, '&');
-					src += 4;
-				}
-				else if(strncmp(src, "&lt;", 4) == 0) {
-					waddch(scr, '<');
-					src += 3;
-				}
-				else if(strncmp(src, "&gt;", 4) == 0) {
-					waddch(scr, '>');
-					src += 3;
-				}
-				else if(strncmp(src, "&quot;", 6) == 0) {
-					waddch(scr, '\"');
-					src += 5;
-				}
-				else if(strncmp(src, "&apos;", 6) == 0) {
-					waddch(scr, '\'');
-					src += 5;
-				}
-				else if(strncmp(src, "&#39;", 5) == 0) {
-					waddch(scr, '\'');
-					src += 4;
-				}
-			} else {
-				// 通常文字
-				waddch(scr, *((unsigned char *)src));
-			}
-		}
-		if(*src == '>') ltgt = 0;
-		src++;
+		stage_stat_add(&render_stat, nano_queue_now() - t);
+		n++;
 	}
 	
-	waddstr(scr, "\n");
+	if(repaint) render_repaint();
 	
-	// 添付メディアのURL表示
-	struct sjson_node *media_attachments;
-	
-	read_json_fom_path(jobj_from_string, "media_attachments", &media_attachments);
-	
-	if(media_attachments->tag == SJSON_ARRAY) {
-		for (int i = 0; i < sjson_child_count(media_attachments); ++i) {
-			struct sjson_node *obj = sjson_find_element(media_attachments, i);
-			struct sjson_node *url;
-			read_json_fom_path(obj, "url", &url);
-			if(url->tag == SJSON_STRING) {
-				waddstr(scr, noemojiflag ? "<LINK>" : "🔗");
-				waddstr(scr, url->string_);
-				waddstr(scr, "\n");
-			}
-		}
+	if(n > 0) {
+		frame_stat.frames++;
+		frame_stat.records += n;
+		if(n > frame_stat.max_records) frame_stat.max_records = n;
 	}
+	if(repaint || changed) wnoutrefresh(scr);
+}
+
+// 描いた内容を1回で端末へ出力する(カーソルは投稿欄へ戻す)
+void render_flush(void)
+{
+	wmove(pad, pad_x, pad_y);
+	wnoutrefresh(pad);
+	doupdate();
+}
+
+// 平均(ミリ秒)
+static double average_ms(uint64_t total_ns, uint64_t count)
+{
+	return count ? total_ns / 1e6 / count : 0;
+}
+
+// 各段の統計を境目の線の上に表示する(-stats)
+void render_stats(void)
+{
+	char buf[256];
+	uint64_t raw_n = atomic_load(&raw_queue.popped), ui_n = atomic_load(&ui_queue.popped);
+	uint64_t parse_n = atomic_load(&parse_stat.count), render_n = atomic_load(&render_stat.count);
+	uint64_t http_n = atomic_load(&nano_http_stat.requests);
+	
+	snprintf(buf, sizeof(buf), "[net>parse q%zu/%llu %.1fms][parse %.2fms][parse>ui q%zu/%llu %.1fms][render %.2fms][frame %llu x%.1f max%llu][reconn %u %.1fs][http %llu %.0fms last%.0fms conn%llu]",
+		nano_queue_depth(&raw_queue), (unsigned long long)atomic_load(&raw_queue.max_depth),
+		average_ms(atomic_load(&raw_queue.wait_ns), raw_n),
+		average_ms(atomic_load(&parse_stat.total_ns), parse_n),
+		nano_queue_depth(&ui_queue), (unsigned long long)atomic_load(&ui_queue.max_depth),
+		average_ms(atomic_load(&ui_queue.wait_ns), ui_n),
+		average_ms(atomic_load(&render_stat.total_ns), render_n),
+		(unsigned long long)frame_stat.frames,
+		frame_stat.frames ? (double)frame_stat.records / frame_stat.frames : 0.0,
+		(unsigned long long)frame_stat.max_records,
+		atomic_load(&stream_stat.reconnects), atomic_load(&stream_stat.last_outage),
+		(unsigned long long)http_n,
+		average_ms(atomic_load(&nano_http_stat.total_ns), http_n),
+		atomic_load(&nano_http_stat.last_ns) / 1e6,
+		(unsigned long long)atomic_load(&nano_http_stat.connects));
+	
+	attron(COLOR_PAIR(2));
+	mvhline(5, 0, '-', term_w);
+	mvaddnstr(5, 0, buf, term_w);
+	attroff(COLOR_PAIR(2));
+	wnoutrefresh(stdscr);
+}
+
+// SSEでストリーミングを受信する,切断されるまで戻らない
+void stream_run_sse(const char *uri, struct curl_slist *slist1, char *errbuf)
+{
+	CURLcode ret;
+	CURL *hnd;
+	
+	hnd = nano_http_acquire();
+	curl_easy_setopt(hnd, CURLOPT_URL, uri);
+	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
+	curl_easy_setopt(hnd, CURLOPT_USERAGENT, CURL_USERAGENT);
+	curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, slist1);
+	curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 50L);
+	curl_easy_setopt(hnd, CURLOPT_CUSTOMREQUEST, "GET");
+	curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 1L);
+	curl_easy_setopt(hnd, CURLOPT_TIMEOUT, 0);
+	curl_easy_setopt(hnd, CURLOPT_FAILONERROR, 1L);
+	curl_easy_setopt(hnd, CURLOPT_LOW_SPEED_LIMIT, 1L);
+	curl_easy_setopt(hnd, CURLOPT_LOW_SPEED_TIME, (long)STREAM_STALL_TIMEOUT);
+	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (void *)&streaming_sse);
+	curl_easy_setopt(hnd, CURLOPT_WRITEFUNCTION, streaming_callback);
+	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
 	
-	// 投稿アプリ名表示
-	struct sjson_node *application_name;
-	int exist_appname = read_json_fom_path(jobj_from_string, "application/name", &application_name);
+	ret = curl_easy_perform(hnd);
+	if(ret == CURLE_OK) strcpy(errbuf, "closed by server");
+	else if(!errbuf[0]) strcpy(errbuf, curl_easy_strerror(ret));
 	
-	// 名前が取れたときのみ表示
-	if(exist_appname) {
-		type = application_name->tag;
-		
-		if(type != SJSON_NULL) {
-			int l = ustrwidth(application_name->string_);
+	nano_http_release(hnd);
+	hnd = NULL;
+	
+	// 受信途中のイベントは捨てる
+	nano_sse_reset(&streaming_sse);
+}
+
+// WebSocketでストリーミングを受信する,1本の接続で複数のストリームを購読する
+void stream_run_ws(struct curl_slist *slist1, char *errbuf)
+{
+	CURL *hnd;
+	struct nano_ws ws;
+	char *uri = create_uri_string(URI_STREAM_WS);
+	
+	// Upgradeする接続は他と共用しないので,共有キャッシュもプールも使わない
+	// (CONNECT_ONLYの接続は共有すると後からcurl_easy_sendで使えなくなる)
+	hnd = curl_easy_init();
+	curl_easy_setopt(hnd, CURLOPT_URL, uri);
+	curl_easy_setopt(hnd, CURLOPT_USERAGENT, CURL_USERAGENT);
+	curl_easy_setopt(hnd, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_1_1);
+	curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 1L);
+	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
+	
+	if(nano_ws_connect(&ws, hnd, domain_string, URI_STREAM_WS, slist1, errbuf, CURL_ERROR_SIZE) == 0) {
+		int ok = ws_subscribe(&ws, selected_stream);
+		for(int i = 0; ok && i < subscription_count; i++) ok = ws_subscribe(&ws, subscriptions[i]);
 		
-			// 右寄せにするために空白を並べる
-			for(int i = 0; i < term_w - (l + 4 + 1); i++) waddstr(scr, " ");
-			
-			wattron(scr, COLOR_PAIR(1));
-			waddstr(scr, "via ");
-			wattroff(scr, COLOR_PAIR(1));
-			wattron(scr, COLOR_PAIR(2));
-			waddstr(scr, application_name->string_);
-			waddstr(scr, "\n");
-			wattroff(scr, COLOR_PAIR(2));
+		if(!ok) {
+			strcpy(errbuf, "subscribe failed");
+		} else {
+			stream_established();
+			if(nano_ws_run(&ws, ws_received, NULL, STREAM_STALL_TIMEOUT, errbuf, CURL_ERROR_SIZE) == 0) {
+				strcpy(errbuf, "closed by server");
+			}
 		}
 	}
 	
-	waddstr(scr, "\n");
-	wrefresh(scr);
-	
-	wmove(pad, pad_x, pad_y);
-	wrefresh(pad);
+	nano_ws_free(&ws);
+	curl_easy_cleanup(hnd);
+	hnd = NULL;
+	free(uri);
+}
+
+// 次の再接続までの待ち時間(ミリ秒),指数的に伸ばし半分の幅でゆらがせる
+long reconnect_delay(unsigned int failures, long retry_ms)
+{
+	long delay = retry_ms > RECONNECT_DELAY_MIN ? retry_ms : RECONNECT_DELAY_MIN;
+	for(unsigned int i = 0; i < failures && delay < RECONNECT_DELAY_MAX; i++) delay *= 2;
+	if(delay > RECONNECT_DELAY_MAX) delay = RECONNECT_DELAY_MAX;
+	return delay / 2 + rand() % (delay / 2 + 1);
 }
 
-// ストリーミングで受信したJSON(接続維持用データを取り除き一体化したもの)
-void streaming_received(void)
+// タイムライン取得スレッド,ストリーミングとは並行して取得する
+void *fetch_thread_func(void *param)
 {
+	unsigned int failures = 0, released = 0;
+	(void)param;
 	
-	// イベント取得
-	if(strncmp(streaming_json, "event", 5) == 0) {
-		char *type = strdup(streaming_json + 7);
-		if(strncmp(type, "update", 6) == 0) stream_event_handler = stream_event_update;
-		else if(strncmp(type, "notification", 12) == 0) stream_event_handler = stream_event_notify;
-		else stream_event_handler = NULL;
+	while(1) {
+		int initial;
+		unsigned int backfills, seq;
+		char min_id[sizeof(fetch_req.backfill_min_id)];
 		
-		char *top = type;
-		while(*type != '\n') type++;
-		type++;
+		pthread_mutex_lock(&fetch_req.lock);
+		while(!fetch_req.initial && !fetch_req.backfills) {
+			pthread_cond_wait(&fetch_req.cond, &fetch_req.lock);
+		}
+		initial = fetch_req.initial;
+		backfills = fetch_req.backfills;
+		seq = fetch_req.hold_seq;
+		strcpy(min_id, fetch_req.backfill_min_id);
+		fetch_req.initial = 0;
+		fetch_req.backfills = 0;
+		pthread_mutex_unlock(&fetch_req.lock);
 		
-		// 後ろにJSONが引っ付いていればJSONバッファへ
-		if(*type != 0) {
-			free(streaming_json);
-			streaming_json = strdup(type);
+		if(initial) {
+			if(get_timeline(NULL, 0, NULL) < 0) failures++;
+			else failures = 0;
 		}
-		free(top);
-	}
-	
-	// JSON受信
-	if(strncmp(streaming_json, "data", 4) == 0) {
-		if(stream_event_handler) {
-			sjson_context* ctx = sjson_create_context(0, 0, NULL);
-			struct sjson_node *jobj_from_string = sjson_decode(ctx, streaming_json + 6);
-			stream_event_handler(jobj_from_string);
-			sjson_destroy_context(ctx);
-			stream_event_handler = NULL;
+		
+		if(backfills) stream_backfill(min_id);
+		
+		// seqまでの依頼はこれで済んだ(取れなくてもストリーミングは表示する)
+		if(seq != released) push_raw_event(&rest_queue, RAW_RELEASE, NULL, NULL, seq);
+		released = seq;
+		
+		if(failures) {
+			// 取れるまで間を置いてやり直す
+			long delay = reconnect_delay(failures, 0);
+			struct timespec ts;
+			ts.tv_sec = delay / 1000;
+			ts.tv_nsec = (delay % 1000) * 1000000L;
+			nanosleep(&ts, NULL);
+			
+			pthread_mutex_lock(&fetch_req.lock);
+			fetch_req.initial = 1;
+			pthread_mutex_unlock(&fetch_req.lock);
 		}
 	}
 	
-	free(streaming_json);
-	streaming_json = NULL;
+	return NULL;
 }
 
 // ストリーミング受信スレッド
 void *stream_thread_func(void *param)
 {
-	get_timeline();
-	
-	CURLcode ret;
-	CURL *hnd;
 	struct curl_slist *slist1;
 	char errbuf[CURL_ERROR_SIZE], *uri;
+	unsigned int failures = 0;
+	(void)param;
 
 	slist1 = NULL;
 	slist1 = curl_slist_append(slist1, access_token);
-	memset(errbuf, 0, sizeof errbuf);
 	
 	char *uri_stream = malloc(strlen(URI_STREAM) + strlen(selected_stream) + 1);
 	
@@ -535,31 +1608,40 @@ void *stream_thread_func(void *param)
 
 	uri = create_uri_string(uri_stream);
 
-	hnd = curl_easy_init();
-	curl_easy_setopt(hnd, CURLOPT_URL, uri);
-	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
-	curl_easy_setopt(hnd, CURLOPT_USERAGENT, CURL_USERAGENT);
-	curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, slist1);
-	curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 50L);
-	curl_easy_setopt(hnd, CURLOPT_CUSTOMREQUEST, "GET");
-	curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 1L);
-	curl_easy_setopt(hnd, CURLOPT_TIMEOUT, 0);
-	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (void *)&streaming_json);
-	curl_easy_setopt(hnd, CURLOPT_WRITEFUNCTION, streaming_callback);
-	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
+	nano_sse_init(&streaming_sse, streaming_received, NULL);
+	srand(time(NULL) ^ getpid());
 	
-	streaming_received_handler = streaming_received;
-	stream_event_handler = NULL;
-	
-	ret = curl_easy_perform(hnd);
-	if(ret != CURLE_OK) curl_fatal(ret, errbuf);
+	// 切断されても終了せず、待ち時間を置いて接続し直す
+	while(1) {
+		memset(errbuf, 0, sizeof errbuf);
+		
+		stream_stat.connected = 0;
+		if(wsflag) stream_run_ws(slist1, errbuf);
+		else stream_run_sse(uri, slist1, errbuf);
+		
+		if(stream_stat.connected) failures = 0;
+		else failures++;
+		
+		if(!stream_stat.disconnected) {
+			stream_stat.disconnected = 1;
+			clock_gettime(CLOCK_MONOTONIC, &stream_stat.down_since);
+		}
+		
+		long delay = reconnect_delay(failures, streaming_sse.retry_ms);
+		post_notice(&raw_queue, "Stream disconnected (%s), reconnecting in %.1fs", errbuf, delay / 1000.0);
+		
+		struct timespec ts;
+		ts.tv_sec = delay / 1000;
+		ts.tv_nsec = (delay % 1000) * 1000000L;
+		nanosleep(&ts, NULL);
+		atomic_fetch_add(&stream_stat.attempts, 1);
+	}
 
-	curl_easy_cleanup(hnd);
-	hnd = NULL;
 	free(uri_stream);
 	free(uri);
 	curl_slist_free_all(slist1);
 	slist1 = NULL;
+	nano_sse_free(&streaming_sse);
 	
 	return NULL;
 }
@@ -679,7 +1761,7 @@ void do_create_client(char *domain, char *dot_ckcs)
 				CURLFORM_COPYCONTENTS, "read write follow",
 				CURLFORM_END);
 
-	hnd = curl_easy_init();
+	hnd = nano_http_acquire();
 	curl_easy_setopt(hnd, CURLOPT_URL, uri);
 	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
 	curl_easy_setopt(hnd, CURLOPT_HTTPPOST, post1);
@@ -690,12 +1772,12 @@ void do_create_client(char *domain, char *dot_ckcs)
 	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, f);	// データの保存先ファイルポインタを指定
 	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
 	
-	ret = curl_easy_perform(hnd);
+	ret = nano_http_perform(hnd);
 	if(ret != CURLE_OK) curl_fatal(ret, errbuf);
 	
 	fclose(f);
 
-	curl_easy_cleanup(hnd);
+	nano_http_release(hnd);
 	hnd = NULL;
 	free(uri);
 	curl_formfree(post1);
@@ -743,7 +1825,7 @@ void do_oauth(char *code, char *ck, char *cs)
 
 	uri = create_uri_string("oauth/token");
 
-	hnd = curl_easy_init();
+	hnd = nano_http_acquire();
 	curl_easy_setopt(hnd, CURLOPT_URL, uri);
 	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
 	curl_easy_setopt(hnd, CURLOPT_HTTPPOST, post1);
@@ -754,12 +1836,12 @@ void do_oauth(char *code, char *ck, char *cs)
 	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, f);	// データの保存先ファイルポインタを指定
 	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
 	
-	ret = curl_easy_perform(hnd);
+	ret = nano_http_perform(hnd);
 	if(ret != CURLE_OK) curl_fatal(ret, errbuf);
 	
 	fclose(f);
 
-	curl_easy_cleanup(hnd);
+	nano_http_release(hnd);
 	hnd = NULL;
 	free(uri);
 	curl_formfree(post1);
@@ -811,7 +1893,7 @@ void do_toot(char *s)
 	slist1 = NULL;
 	slist1 = curl_slist_append(slist1, access_token);
 
-	hnd = curl_easy_init();
+	hnd = nano_http_acquire();
 	curl_easy_setopt(hnd, CURLOPT_URL, uri);
 	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
 	curl_easy_setopt(hnd, CURLOPT_HTTPPOST, post1);
@@ -822,12 +1904,12 @@ void do_toot(char *s)
 	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, f);
 	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
 
-	ret = curl_easy_perform(hnd);
+	ret = nano_http_perform(hnd);
 	if(ret != CURLE_OK) curl_fatal(ret, errbuf);
 
 	fclose(f);
 	
-	curl_easy_cleanup(hnd);
+	nano_http_release(hnd);
 	hnd = NULL;
 	free(uri);
 	curl_formfree(post1);
@@ -836,87 +1918,142 @@ void do_toot(char *s)
 	slist1 = NULL;
 }
 
+// HTLの受信バッファ
+// 長さを保持し倍々で伸ばすことで、受信ごとのstrlen/reallocによる二乗時間を避ける
+struct recv_buffer {
+	char *data;
+	size_t len;	// 受信済みバイト数
+	size_t cap;	// 確保済みバイト数
+};
+
+// 受信バッファに追記する(容量は倍々に伸ばす)
+int recv_buffer_append(struct recv_buffer *rb, const char *src, size_t n)
+{
+	if(rb->len + n + 1 > rb->cap) {
+		size_t cap = rb->cap ? rb->cap : 4096;
+		while(cap < rb->len + n + 1) cap *= 2;
+		char *p = realloc(rb->data, cap);
+		if(!p) return 0;
+		rb->data = p;
+		rb->cap = cap;
+	}
+	
+	memcpy(rb->data + rb->len, src, n);
+	rb->len += n;
+	rb->data[rb->len] = 0;
+	return 1;
+}
+
 // curlから呼び出されるHTL受信関数
 size_t htl_callback(void* ptr, size_t size, size_t nmemb, void* data) {
 	if (size * nmemb == 0)
 		return 0;
 	
-	char **json = ((char **)data);
-	
 	size_t realsize = size * nmemb;
 	
-	size_t length = realsize + 1;
-	char *str = *json;
-	str = realloc(str, (str ? strlen(str) : 0) + length);
-	if(*((char **)data) == NULL) strcpy(str, "");
-	
-	*json = str;
-	
-	if (str != NULL) {
-		strncat(str, ptr, realsize);
-	}
+	if(!recv_buffer_append((struct recv_buffer *)data, ptr, realsize)) return 0;
 
 	return realsize;
 }
 
-// Timelineの受信
-void get_timeline(void)
+// curlから呼び出されるヘッダ受信関数,Linkヘッダからrel="prev"のmin_idを取り出す
+size_t htl_header_callback(char *buffer, size_t size, size_t nitems, void *data)
+{
+	size_t len = size * nitems;
+	char *next_min_id = data;
+	
+	if(len > 5 && strncasecmp(buffer, "link:", 5) == 0) {
+		char *line = strndup(buffer, len);
+		char *prev = strstr(line, "rel=\"prev\"");
+		if(prev) {
+			// rel="prev"の直前の<...>がURL
+			*prev = 0;
+			char *url = strrchr(line, '<');
+			char *p = url ? strstr(url, "min_id=") : NULL;
+			if(p) {
+				p += 7;
+				size_t n = strspn(p, "0123456789");
+				if(n < 32) {
+					memcpy(next_min_id, p, n);
+					next_min_id[n] = 0;
+				}
+			}
+		}
+		free(line);
+	}
+	
+	return len;
+}
+
+// Timelineの受信(min_idを指定するとそれより新しいものだけ),タイムライン取得スレッドで呼ばれる
+// 成功すれば受信したバイト数、失敗時は-1を返す,next_min_idには次のページのmin_idが入る
+int get_timeline(const char *min_id, int limit, char *next_min_id)
 {
 	CURLcode ret;
 	CURL *hnd;
 	struct curl_slist *slist1;
 	char errbuf[CURL_ERROR_SIZE], *uri;
+	char link_min_id[32] = "";
+	int count = 0;
 
 	slist1 = NULL;
 	slist1 = curl_slist_append(slist1, access_token);
 	memset(errbuf, 0, sizeof errbuf);
 	
-	char *uri_timeline = malloc(strlen(URI_TIMELINE) + strlen(selected_timeline) + 1);
+	char *uri_timeline = malloc(strlen(URI_TIMELINE) + strlen(selected_timeline) + 64);
 	
 	strcpy(uri_timeline, URI_TIMELINE);
 	strcat(uri_timeline, selected_timeline);
 	
+	// selected_timelineが既にクエリを含んでいることがある
+	if(min_id) {
+		sprintf(uri_timeline + strlen(uri_timeline), "%cmin_id=%s", strchr(selected_timeline, '?') ? '&' : '?', min_id);
+	}
+	if(limit > 0) {
+		sprintf(uri_timeline + strlen(uri_timeline), "%climit=%d", strchr(uri_timeline, '?') ? '&' : '?', limit);
+	}
+	
 	uri = create_uri_string(uri_timeline);
 
-	char *json = NULL;
+	struct recv_buffer body = { NULL, 0, 0 };
 
-	hnd = curl_easy_init();
+	hnd = nano_http_acquire();
 	curl_easy_setopt(hnd, CURLOPT_URL, uri);
 	curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
 	curl_easy_setopt(hnd, CURLOPT_USERAGENT, CURL_USERAGENT);
 	curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, slist1);
 	curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 50L);
 	curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 1L);
-	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (void *)&json);
+	curl_easy_setopt(hnd, CURLOPT_FAILONERROR, 1L);
+	curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (void *)&body);
 	curl_easy_setopt(hnd, CURLOPT_WRITEFUNCTION, htl_callback);
+	curl_easy_setopt(hnd, CURLOPT_HEADERDATA, (void *)link_min_id);
+	curl_easy_setopt(hnd, CURLOPT_HEADERFUNCTION, htl_header_callback);
 	curl_easy_setopt(hnd, CURLOPT_ERRORBUFFER, errbuf);
 	
-	ret = curl_easy_perform(hnd);
-	if(ret != CURLE_OK) curl_fatal(ret, errbuf);
-
-
-	sjson_context* ctx = sjson_create_context(0, 0, NULL);
-	struct sjson_node *jobj_from_string = sjson_decode(ctx, json);
-	sjson_tag type;
-	
-	type = jobj_from_string->tag;
-	
-	if(type == SJSON_ARRAY) {
-		for (int i = sjson_child_count(jobj_from_string) - 1; i >= 0; i--) {
-			struct sjson_node *obj = sjson_find_element(jobj_from_string, i);
-			
-			stream_event_update(obj);
-		}
+	ret = nano_http_perform(hnd);
+	
+	if(ret != CURLE_OK) {
+		// 終了はせず、接続できたときに補完する
+		post_notice(&rest_queue, "Timeline fetch failed (%s)", errbuf[0] ? errbuf : curl_easy_strerror(ret));
+		free(body.data);
+		count = -1;
+	} else if(body.data) {
+		// パースと表示は後段のスレッドで
+		count = body.len;
+		push_raw_event(&rest_queue, RAW_TIMELINE, NULL, body.data, count);
 	}
 	
-	sjson_destroy_context(ctx);
+	if(next_min_id) strcpy(next_min_id, link_min_id);
 
-	curl_easy_cleanup(hnd);
+	nano_http_release(hnd);
 	hnd = NULL;
 	free(uri_timeline);
 	free(uri);
 	curl_slist_free_all(slist1);
 	slist1 = NULL;
+	
+	return count;
 }
 
 sjson_node *read_json_from_file(char *path, char **json_p, sjson_context **ctx_p)
@@ -949,6 +2086,12 @@ int main(int argc, char *argv[])
 {
 	config.profile_name[0] = 0;
 	
+	// 以降のHTTPリクエストは接続を使い回す
+	if(!nano_http_init()) {
+		fprintf(stderr, "FATAL: Can't initialize libcurl\n");
+		return -1;
+	}
+	
 	// オプション解析
 	for(int i=1;i<argc;i++) {
 		if(!strcmp(argv[i],"-mono")) {
@@ -960,6 +2103,49 @@ int main(int argc, char *argv[])
 		} else if(!strcmp(argv[i],"-noemoji")) {
 			noemojiflag = 1;
 			printf("Hide UI emojis.\n");
+		} else if(!strcmp(argv[i],"-ws")) {
+			wsflag = 1;
+			printf("Use WebSocket streaming.\n");
+		} else if(!strncmp(argv[i],"-subscribe",10)) {
+			i++;
+			if(i >= argc) {
+				fprintf(stderr,"too few argments\n");
+				return -1;
+			}
+			if(subscription_count >= MAX_SUBSCRIPTIONS) {
+				fprintf(stderr,"Too many subscriptions\n");
+				return -1;
+			}
+			subscriptions[subscription_count++] = argv[i];
+			wsflag = 1;
+			printf("Subscribe: %s\n", argv[i]);
+		} else if(!strcmp(argv[i],"-stats")) {
+			statsflag = 1;
+			printf("Show pipeline statistics.\n");
+		} else if(!strncmp(argv[i],"-fps",4)) {
+			i++;
+			if(i >= argc) {
+				fprintf(stderr,"too few argments\n");
+				return -1;
+			}
+			frame_rate = atoi(argv[i]);
+			if(frame_rate <= 0) {
+				fprintf(stderr,"Invalid frame rate %s\n", argv[i]);
+				return -1;
+			}
+			printf("Frame rate: %d\n", frame_rate);
+		} else if(!strncmp(argv[i],"-parse-threads",14)) {
+			i++;
+			if(i >= argc) {
+				fprintf(stderr,"too few argments\n");
+				return -1;
+			}
+			parse_threads = atoi(argv[i]);
+			if(parse_threads <= 0) {
+				fprintf(stderr,"Invalid thread count %s\n", argv[i]);
+				return -1;
+			}
+			printf("Parse threads: %d\n", parse_threads);
 		} else if(!strncmp(argv[i],"-profile",8)) {
 			i++;
 			if(i >= argc) {
@@ -1012,8 +2198,8 @@ int main(int argc, char *argv[])
 		char *json;
 		struct sjson_node *token;
 		struct sjson_node *jobj_from_file = read_json_from_file(config.dot_token, &json, &ctx);
-		read_json_fom_path(jobj_from_file, "access_token", &token);
-		sprintf(access_token, "Authorization: Bearer %s", token->string_);
+		token = nano_json_get(jobj_from_file, "access_token");
+		sprintf(access_token, "Authorization: Bearer %s", token && token->tag == SJSON_STRING ? token->string_ : "");
 		FILE *f2 = fopen(config.dot_domain, "rb");
 		fscanf(f2, "%255s", domain_string);
 		fclose(f2);
@@ -1062,9 +2248,9 @@ retry1:
 		char *json;
 		struct sjson_node *cko, *cso;
 		struct sjson_node *jobj_from_file = read_json_from_file(json_name, &json, &ctx);
-		int r1 = read_json_fom_path(jobj_from_file, "client_id", &cko);
-		int r2 = read_json_fom_path(jobj_from_file, "client_secret", &cso);
-		if(!r1 || !r2) {
+		cko = nano_json_get(jobj_from_file, "client_id");
+		cso = nano_json_get(jobj_from_file, "client_secret");
+		if(!cko || !cso || cko->tag != SJSON_STRING || cso->tag != SJSON_STRING) {
 			// もしおかしければ最初まで戻る
 			printf(nano_msg_list[msg_lang][NANO_MSG_SOME_WRONG_DOMAIN]);
 			remove(json_name);
@@ -1096,8 +2282,8 @@ retry1:
 		// トークンファイルを読む
 		struct sjson_node *token;
 		jobj_from_file = read_json_from_file(config.dot_token, &json, &ctx);
-		int r3 = read_json_fom_path(jobj_from_file, "access_token", &token);
-		if(!r3) {
+		token = nano_json_get(jobj_from_file, "access_token");
+		if(!token || token->tag != SJSON_STRING) {
 			// もしおかしければ最初まで戻る
 			printf(nano_msg_list[msg_lang][NANO_MSG_SOME_WRONG_OAUTH]);
 			remove(json_name);
@@ -1144,14 +2330,27 @@ retry1:
 	// 投稿欄用Window
 	pad = newwin(5, term_w, 0, 0);
 	
-	scrollok(scr, 1);
-	
 	wrefresh(scr);
 	
-	pthread_t stream_thread;
+	pthread_t stream_thread, fetch_thread, parse_thread;
+	sigset_t sigs, oldsigs;
+	
+	nano_queue_init(&raw_queue, RAW_QUEUE_SIZE);
+	nano_queue_init(&rest_queue, RAW_QUEUE_SIZE);
+	nano_queue_init(&ui_queue, UI_QUEUE_SIZE);
+	nano_timeline_init(&timeline, TIMELINE_MAX);
+	
+	// SIGWINCHはUIスレッドのpollを起こすようにメインスレッドだけで受ける
+	sigemptyset(&sigs);
+	sigaddset(&sigs, SIGWINCH);
+	pthread_sigmask(SIG_BLOCK, &sigs, &oldsigs);
 	
-	// ストリーミングスレッド生成
+	// ストリーミングスレッドとパーススレッド生成
 	pthread_create(&stream_thread, NULL, stream_thread_func, NULL);
+	pthread_create(&fetch_thread, NULL, fetch_thread_func, NULL);
+	pthread_create(&parse_thread, NULL, parse_thread_func, NULL);
+	
+	pthread_sigmask(SIG_SETMASK, &oldsigs, NULL);
 	
 	STB_TexteditState state;
 	text_control txt;
@@ -1162,11 +2361,12 @@ retry1:
 	stb_textedit_initialize_state(&state, 0);
 	
 	keypad(pad, TRUE);
+	nodelay(pad, TRUE);
 	noecho();
 	
 	// 投稿欄との境目の線
 	attron(COLOR_PAIR(2));
-	for(int i = 0; i < term_w; i++) mvaddch(5, i, '-');
+	mvhline(5, 0, '-', term_w);
 	attroff(COLOR_PAIR(2));
 	refresh();
 	
@@ -1185,69 +2385,117 @@ retry1:
 	refresh();
 	wmove(pad, 0, 0);*/
 	
+	// UIスレッド: curses呼び出しは全てこのスレッドで行う
+	struct pollfd pfd[2];
+	pfd[0].fd = 0;
+	pfd[0].events = POLLIN;
+	pfd[1].fd = nano_queue_fd(&ui_queue);
+	pfd[1].events = POLLIN;
+	
+	// 画面更新は1フレームに1回まで、その間に届いたレコードはまとめて描く
+	uint64_t frame_ns = 1000000000ULL / frame_rate;
+	uint64_t next_frame = 0;
+	
 	while (1)
 	{
 		wchar_t c;
-		wget_wch(pad, &c);
-		if(c == KEY_RESIZE) {
-			// リサイズ処理
-			getmaxyx(term, term_h, term_w);
-			
-			// 境目の線再描画
-			attron(COLOR_PAIR(2));
-			for(int i = 0; i < term_w; i++) mvaddch(5, i, '-');
-			attroff(COLOR_PAIR(2));
-			refresh();
-			
-			// Windowリサイズ
-			werase(scr);
-			wresize(scr, term_h - 6, term_w);
-			wresize(pad, 5, term_w);
-			
-			// TL再取得
-			get_timeline();
-			
-			wrefresh(pad);
-			wrefresh(scr);
-		} else if(c == 0x1b && txt.string) {
-			// 投稿処理
-			werase(pad);
-			wchar_t *text = malloc(sizeof(wchar_t) * (txt.stringlen + 1));
-			memcpy(text, txt.string, sizeof(wchar_t) * txt.stringlen);
-			text[txt.stringlen] = 0;
-			char status[1024];
-			wcstombs(status, text, 1024);
-			do_toot(status);
-			free(text);
-			txt.string = 0;
-			txt.stringlen = 0;
-		} else {
-			// 通常文字
-			stb_textedit_key(&txt, &state, c);
+		int timeout = statsflag ? 1000 : -1;
+		uint64_t now = nano_queue_now();
+		
+		// 未表示のレコードがあれば次のフレームまで待つ
+		if(nano_queue_depth(&ui_queue) > 0) {
+			timeout = now >= next_frame ? 0 : (int)((next_frame - now + 999999) / 1000000);
 		}
 		
-		// 投稿欄内容表示
-		werase(pad);
-		wmove(pad, 0, 0);
-		int cx=-1, cy=-1;
-		for(int i = 0; i < txt.stringlen; i++) {
-			if(i == state.cursor) getyx(pad, cx, cy);
-			wchar_t s[2];
-			char mb[8];
-			s[0] = txt.string[i];
-			s[1] = 0;
-			wcstombs(mb, s, 8);
-			waddstr(pad, mb);
+		// キー入力かパース済みレコードの到着を待つ
+		poll(pfd, 2, timeout);
+		nano_queue_drain_wake(&ui_queue);
+		
+		now = nano_queue_now();
+		if(now >= next_frame && nano_queue_depth(&ui_queue) > 0) {
+			render_pending_records();
+			next_frame = now + frame_ns;
 		}
-		if(cx>=0&&cy>=0) {
-			wmove(pad, cx, cy);
-			pad_x = cx;
-			pad_y = cy;
-		} else {
-			pad_x = 0;
-			pad_y = 0;
+		if(statsflag) render_stats();
+		render_flush();
+		
+		while (wget_wch(pad, &c) != ERR)
+		{
+			if(c == KEY_RESIZE) {
+				// リサイズ処理
+				getmaxyx(term, term_h, term_w);
+				
+				// 境目の線再描画
+				attron(COLOR_PAIR(2));
+				mvhline(5, 0, '-', term_w);
+				attroff(COLOR_PAIR(2));
+				refresh();
+				
+				// Windowリサイズ
+				wresize(scr, term_h - 6, term_w);
+				wresize(pad, 5, term_w);
+				
+				// 保持しているレコードから新しい幅で描き直す(取得し直さない)
+				render_repaint();
+				
+				wrefresh(pad);
+				wrefresh(scr);
+			} else if(c == KEY_PPAGE || c == KEY_NPAGE || ((c == KEY_HOME || c == KEY_END) && txt.stringlen == 0)) {
+				// タイムラインのスクロール(Home/Endは投稿欄が空のときだけ)
+				int page = getmaxy(scr) > 2 ? getmaxy(scr) - 1 : 1;
+				if(c == KEY_PPAGE) view_scroll(page);
+				else if(c == KEY_NPAGE) view_scroll(-page);
+				else if(c == KEY_HOME) view_home();
+				else view_end();
+				render_repaint();
+				wnoutrefresh(scr);
+				render_flush();
+				continue;
+			} else if(c == 0x1b && txt.string) {
+				// 投稿処理
+				werase(pad);
+				wchar_t *text = malloc(sizeof(wchar_t) * (txt.stringlen + 1));
+				memcpy(text, txt.string, sizeof(wchar_t) * txt.stringlen);
+				text[txt.stringlen] = 0;
+				char status[1024];
+				wcstombs(status, text, 1024);
+				do_toot(status);
+				free(text);
+				txt.string = 0;
+				txt.stringlen = 0;
+			} else {
+				// 通常文字
+				stb_textedit_key(&txt, &state, c);
+			}
+			
+			// 投稿欄内容表示(カーソルの前後をそれぞれ1回で出す)
+			werase(pad);
+			wmove(pad, 0, 0);
+			if(txt.stringlen > 0) {
+				int cursor = state.cursor < txt.stringlen ? state.cursor : txt.stringlen;
+				size_t size = (size_t)txt.stringlen * MB_CUR_MAX + 1;
+				wchar_t *w = malloc(sizeof(wchar_t) * (txt.stringlen + 1));
+				char *mb = malloc(size);
+				
+				// カーソルの前
+				memcpy(w, txt.string, sizeof(wchar_t) * cursor);
+				w[cursor] = 0;
+				if(wcstombs(mb, w, size) != (size_t)-1) waddstr(pad, mb);
+				getyx(pad, pad_x, pad_y);
+				
+				// カーソルの後
+				memcpy(w, txt.string + cursor, sizeof(wchar_t) * (txt.stringlen - cursor));
+				w[txt.stringlen - cursor] = 0;
+				if(wcstombs(mb, w, size) != (size_t)-1) waddstr(pad, mb);
+				free(w);
+				free(mb);
+			} else {
+				pad_x = 0;
+				pad_y = 0;
+			}
+			wmove(pad, pad_x, pad_y);
+			wrefresh(pad);
 		}
-		wrefresh(pad);
 	}
 
 	return 0;
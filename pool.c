@@ -0,0 +1,101 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pool.h"
+
+int nano_pool_cpus(int max)
+{
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n < 1) n = 1;
+	if(n > max) n = max;
+	return (int)n;
+}
+
+// 添字を1つずつ取って処理する
+static void pool_work(struct nano_pool *p)
+{
+	size_t i;
+	while((i = atomic_fetch_add(&p->next, 1)) < p->count) {
+		p->func(p->arg, i);
+	}
+}
+
+static void *pool_thread_func(void *param)
+{
+	struct nano_pool *p = param;
+	unsigned seen = 0;
+	
+	pthread_mutex_lock(&p->lock);
+	while(1) {
+		while(!p->quit && p->generation == seen) pthread_cond_wait(&p->start, &p->lock);
+		if(p->quit) break;
+		seen = p->generation;
+		pthread_mutex_unlock(&p->lock);
+		
+		pool_work(p);
+		
+		pthread_mutex_lock(&p->lock);
+		if(--p->busy == 0) pthread_cond_signal(&p->done);
+	}
+	pthread_mutex_unlock(&p->lock);
+	return NULL;
+}
+
+int nano_pool_init(struct nano_pool *p, int threads)
+{
+	memset(p, 0, sizeof(*p));
+	pthread_mutex_init(&p->lock, NULL);
+	pthread_cond_init(&p->start, NULL);
+	pthread_cond_init(&p->done, NULL);
+	if(threads <= 1) return 1;
+	
+	p->threads = calloc(threads - 1, sizeof(pthread_t));
+	if(!p->threads) return 0;
+	for(int i = 0; i < threads - 1; i++) {
+		if(pthread_create(&p->threads[i], NULL, pool_thread_func, p) != 0) break;
+		p->nthreads++;
+	}
+	return 1;
+}
+
+void nano_pool_free(struct nano_pool *p)
+{
+	pthread_mutex_lock(&p->lock);
+	p->quit = 1;
+	pthread_cond_broadcast(&p->start);
+	pthread_mutex_unlock(&p->lock);
+	for(int i = 0; i < p->nthreads; i++) pthread_join(p->threads[i], NULL);
+	free(p->threads);
+	p->threads = NULL;
+	p->nthreads = 0;
+	pthread_mutex_destroy(&p->lock);
+	pthread_cond_destroy(&p->start);
+	pthread_cond_destroy(&p->done);
+}
+
+void nano_pool_for(struct nano_pool *p, size_t count, void (*func)(void *arg, size_t i), void *arg)
+{
+	p->func = func;
+	p->arg = arg;
+	p->count = count;
+	atomic_store(&p->next, 0);
+	
+	// 少なければワーカーを起こすより自分でやった方が早い
+	if(p->nthreads == 0 || count < 2) {
+		pool_work(p);
+		return;
+	}
+	
+	pthread_mutex_lock(&p->lock);
+	p->busy = p->nthreads;
+	p->generation++;
+	pthread_cond_broadcast(&p->start);
+	pthread_mutex_unlock(&p->lock);
+	
+	pool_work(p);
+	
+	// ワーカーが全員funcとargから手を離すまで待つ
+	pthread_mutex_lock(&p->lock);
+	while(p->busy > 0) pthread_cond_wait(&p->done, &p->lock);
+	pthread_mutex_unlock(&p->lock);
+}
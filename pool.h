@@ -0,0 +1,37 @@
+#ifndef NANOTODON_POOL_H
+#define NANOTODON_POOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <pthread.h>
+
+// 添字0..count-1の処理を分け合う小さなワーカープール
+// nano_pool_forを呼ぶスレッドは1つだけであること(呼んだスレッドも処理に加わる)
+struct nano_pool {
+	pthread_t *threads;
+	int nthreads;			// 呼び出し側を含まないワーカーの数
+	pthread_mutex_t lock;
+	pthread_cond_t start;		// 仕事が来たことをワーカーに知らせる
+	pthread_cond_t done;		// ワーカーが全員手を離したことを知らせる
+	unsigned generation;		// 仕事ごとに増やす
+	int busy;			// 今の仕事をまだ抱えているワーカーの数
+	int quit;
+
+	void (*func)(void *arg, size_t i);
+	void *arg;
+	size_t count;
+	_Atomic size_t next;		// 次に取る添字
+};
+
+// 使えるCPUの数(maxで頭打ち)
+int nano_pool_cpus(int max);
+
+// threadsは呼び出し側を含めた並列数,1以下ならワーカーを作らない
+int nano_pool_init(struct nano_pool *p, int threads);
+void nano_pool_free(struct nano_pool *p);
+
+// func(arg, i)をi=0..count-1について呼び,すべて終わってから戻る
+// 呼ばれる順番とスレッドは決まっていない
+void nano_pool_for(struct nano_pool *p, size_t count, void (*func)(void *arg, size_t i), void *arg);
+
+#endif
@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include "queue.h"
+
+uint64_t nano_queue_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int nano_queue_init(struct nano_queue *q, size_t capacity)
+{
+	size_t cap = 1;
+	while(cap < capacity) cap <<= 1;
+
+	memset(q, 0, sizeof(*q));
+	q->slots = calloc(cap, sizeof(struct nano_queue_slot));
+	if(!q->slots) return 0;
+	q->mask = cap - 1;
+
+	if(pipe(q->wake_fd) != 0) {
+		free(q->slots);
+		q->slots = NULL;
+		return 0;
+	}
+	fcntl(q->wake_fd[0], F_SETFL, fcntl(q->wake_fd[0], F_GETFL) | O_NONBLOCK);
+	fcntl(q->wake_fd[1], F_SETFL, fcntl(q->wake_fd[1], F_GETFL) | O_NONBLOCK);
+	return 1;
+}
+
+void nano_queue_free(struct nano_queue *q)
+{
+	free(q->slots);
+	q->slots = NULL;
+	close(q->wake_fd[0]);
+	close(q->wake_fd[1]);
+}
+
+void nano_queue_push(struct nano_queue *q, void *item)
+{
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	size_t head = atomic_load(&q->head);
+
+	// 満杯なら消費者が追いつくまで待つ
+	if(tail - head > q->mask) {
+		struct timespec ts = { 0, 1000000L };
+		atomic_fetch_add_explicit(&q->full_waits, 1, memory_order_relaxed);
+		do {
+			nanosleep(&ts, NULL);
+			head = atomic_load(&q->head);
+		} while(tail - head > q->mask);
+	}
+
+	q->slots[tail & q->mask].item = item;
+	q->slots[tail & q->mask].stamp = nano_queue_now();
+	atomic_store(&q->tail, tail + 1);
+
+	uint64_t depth = tail + 1 - head;
+	if(depth > atomic_load_explicit(&q->max_depth, memory_order_relaxed)) {
+		atomic_store_explicit(&q->max_depth, depth, memory_order_relaxed);
+	}
+	atomic_fetch_add_explicit(&q->pushed, 1, memory_order_relaxed);
+
+	// 空だったところに投入したら消費者を起こす
+	if(tail == atomic_load(&q->head)) {
+		char c = 0;
+		while(write(q->wake_fd[1], &c, 1) < 0 && errno == EINTR);
+	}
+}
+
+void *nano_queue_pop(struct nano_queue *q)
+{
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	size_t tail = atomic_load(&q->tail);
+
+	if(head == tail) return NULL;
+
+	struct nano_queue_slot *slot = &q->slots[head & q->mask];
+	void *item = slot->item;
+	uint64_t wait = nano_queue_now() - slot->stamp;
+	atomic_store(&q->head, head + 1);
+
+	atomic_fetch_add_explicit(&q->popped, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&q->wait_ns, wait, memory_order_relaxed);
+	if(wait > atomic_load_explicit(&q->max_wait_ns, memory_order_relaxed)) {
+		atomic_store_explicit(&q->max_wait_ns, wait, memory_order_relaxed);
+	}
+	return item;
+}
+
+void nano_queue_wait(struct nano_queue *q, int timeout_ms)
+{
+	struct pollfd pfd;
+
+	if(nano_queue_depth(q) > 0) return;
+
+	pfd.fd = q->wake_fd[0];
+	pfd.events = POLLIN;
+	poll(&pfd, 1, timeout_ms);
+	nano_queue_drain_wake(q);
+}
+
+int nano_queue_fd(struct nano_queue *q)
+{
+	return q->wake_fd[0];
+}
+
+void nano_queue_drain_wake(struct nano_queue *q)
+{
+	char buf[64];
+	while(read(q->wake_fd[0], buf, sizeof(buf)) > 0);
+}
+
+size_t nano_queue_depth(struct nano_queue *q)
+{
+	return atomic_load(&q->tail) - atomic_load(&q->head);
+}
@@ -0,0 +1,51 @@
+#ifndef NANOTODON_QUEUE_H
+#define NANOTODON_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+// 単一生産者・単一消費者のロックフリー有界キュー
+// 生産者スレッドと消費者スレッドはそれぞれ1つだけであること
+struct nano_queue_slot {
+	void *item;
+	uint64_t stamp;		// 投入時刻(ナノ秒)
+};
+
+struct nano_queue {
+	struct nano_queue_slot *slots;
+	size_t mask;			// 容量-1(容量は2の冪)
+	_Atomic size_t head;		// 次に取り出す位置(消費者が進める)
+	_Atomic size_t tail;		// 次に投入する位置(生産者が進める)
+	int wake_fd[2];			// 空でなくなったことを消費者に知らせるパイプ
+
+	// 統計
+	_Atomic uint64_t pushed;
+	_Atomic uint64_t popped;
+	_Atomic uint64_t full_waits;	// 満杯で生産者が待たされた回数
+	_Atomic uint64_t max_depth;
+	_Atomic uint64_t wait_ns;	// キュー内で待った時間の合計
+	_Atomic uint64_t max_wait_ns;
+};
+
+// 現在時刻(ナノ秒,単調増加)
+uint64_t nano_queue_now(void);
+
+int nano_queue_init(struct nano_queue *q, size_t capacity);
+void nano_queue_free(struct nano_queue *q);
+
+// 投入する,満杯なら空きができるまで待つ(生産者スレッドから)
+void nano_queue_push(struct nano_queue *q, void *item);
+
+// 取り出す,空ならNULL(消費者スレッドから)
+void *nano_queue_pop(struct nano_queue *q);
+
+// 空でなくなるまで待つ,timeout_msが負なら無期限(消費者スレッドから)
+void nano_queue_wait(struct nano_queue *q, int timeout_ms);
+
+// poll()で待つためのfd,読めるようになったらnano_queue_drain_wakeを呼ぶ
+int nano_queue_fd(struct nano_queue *q);
+void nano_queue_drain_wake(struct nano_queue *q);
+
+size_t nano_queue_depth(struct nano_queue *q);
+
+#endif
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <string.h>
+#include "seen.h"
+
+int nano_seen_init(struct nano_seen *s, size_t limit)
+{
+	size_t n = 16;
+	while(n < limit * 2) n <<= 1;
+	
+	memset(s, 0, sizeof(*s));
+	s->cur = calloc(n, sizeof(uint64_t));
+	s->old = calloc(n, sizeof(uint64_t));
+	if(!s->cur || !s->old) {
+		nano_seen_free(s);
+		return 0;
+	}
+	s->mask = n - 1;
+	s->limit = limit;
+	return 1;
+}
+
+void nano_seen_free(struct nano_seen *s)
+{
+	free(s->cur);
+	free(s->old);
+	s->cur = s->old = NULL;
+}
+
+// keyの入っている位置か,無ければ入れるべき空き位置
+static uint64_t *probe(const struct nano_seen *s, uint64_t *table, uint64_t key)
+{
+	size_t i = (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & s->mask;
+	while(table[i] != 0 && table[i] != key) i = (i + 1) & s->mask;
+	return &table[i];
+}
+
+int nano_seen_add(struct nano_seen *s, uint64_t key)
+{
+	if(key == 0) return 1;
+	
+	uint64_t *slot = probe(s, s->cur, key);
+	if(*slot == key || *probe(s, s->old, key) == key) return 0;
+	
+	if(s->count >= s->limit) {
+		// 世代交代
+		uint64_t *t = s->old;
+		s->old = s->cur;
+		s->cur = t;
+		memset(s->cur, 0, (s->mask + 1) * sizeof(uint64_t));
+		s->count = 0;
+		slot = probe(s, s->cur, key);
+	}
+	*slot = key;
+	s->count++;
+	return 1;
+}
+
+void nano_seen_clear(struct nano_seen *s)
+{
+	memset(s->cur, 0, (s->mask + 1) * sizeof(uint64_t));
+	memset(s->old, 0, (s->mask + 1) * sizeof(uint64_t));
+	s->count = 0;
+}
@@ -0,0 +1,27 @@
+#ifndef NANOTODON_SEEN_H
+#define NANOTODON_SEEN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 表示したToot IDの集合(重複除去用)
+// 新旧2世代の表で持ち,新しい方がいっぱいになったら古い方を捨てて入れ替える
+// そのため覚えている数はlimit〜2*limitで,メモリは一定
+struct nano_seen {
+	uint64_t *cur;		// 0は空き
+	uint64_t *old;
+	size_t mask;		// 表の大きさ-1(2の冪,limitの2倍以上)
+	size_t count;		// curに入っている数
+	size_t limit;
+};
+
+int nano_seen_init(struct nano_seen *s, size_t limit);
+void nano_seen_free(struct nano_seen *s);
+
+// 追加する,既にあれば0を返す(keyが0なら常に1)
+int nano_seen_add(struct nano_seen *s, uint64_t key);
+
+// すべて忘れる
+void nano_seen_clear(struct nano_seen *s);
+
+#endif
@@ -0,0 +1,13 @@
+#include <stdlib.h>
+#include "arena.h"
+
+// sjsonの実装,alloc_userにarenaを渡したコンテキストはarenaから確保する
+// (テストは確保を数える版を先に定義してからこのファイルを取り込む)
+#ifndef sjson_malloc
+#define sjson_malloc(user, size)		((user) ? nano_arena_alloc((user), (size)) : malloc(size))
+#define sjson_free(user, ptr)			((user) ? nano_arena_release((user), (ptr)) : free(ptr))
+#define sjson_realloc(user, ptr, size)	((user) ? nano_arena_realloc((user), (ptr), (size)) : realloc((ptr), (size)))
+#endif
+
+#define SJSON_IMPLEMENT
+#include "sjson.h"
@@ -46,6 +46,14 @@
 //
 //  --- DECODE/ENCODE/VALIDATE
 //	   sjson_decode				Decodes the json text and returns DOM document root node
+//	   sjson_decode_insitu		Same as sjson_decode, but decodes strings inside the json buffer itself
+//								Strings without escapes are terminated in place and are not copied, escaped
+//								strings are unescaped in place. The buffer is modified and must outlive the DOM
+//	   sjson_decode_tape		Validates len bytes of json holding one value and returns it as a flat array of
+//								64-bit words (see SJSON_TAPE_WORD) instead of a DOM, nothing but the array is allocated
+//								Strings are not unescaped, their words point into json and tell whether they
+//								contain escapes. json must be followed by a NUL somewhere in the same buffer
+//								The array is owned by the context and is overwritten by the next call
 //	   sjson_encode				Encodes the json root node to json string, does not prettify
 //							    Generated string can be freed by calling 'sjson_free_string' on the returned pointer
 //	   sjson_stringify			Encodes the json root node to pretty json string
@@ -58,7 +66,17 @@
 //	   sjson_find_member		Finds an element by name inside object				
 //	   sjson_find_member_nocase	Finds an element by name inside object, ignores case			
 //	   sjson_first_child		Gets first child of Object or Array types		
+//	   sjson_last_child			Gets last child of Object or Array types
+//	   sjson_child_count		Number of children of Object or Array types, O(1)
 //	   sjson_foreach			Iterates through an Object or array child elements, first parameter should be a pre-defined json_node*
+//	   sjson_foreach_reverse	Same as sjson_foreach, from the last child to the first
+//	   sjson_index_arrays		When enabled, sjson_decode builds a contiguous child table for every array
+//								so sjson_find_element is O(1). The table lives in the context string pages
+//								and is dropped when the array is modified
+//	   sjson_index_objects		When enabled, sjson_decode builds a key hash table for objects with at least
+//								SJSON_MEMBER_INDEX_MIN members, sjson_find_member then probes it instead of
+//								comparing every key. Same lifetime rules as sjson_index_arrays
+//	   sjson_find_member_hashed	sjson_find_member with a key length and sjson_key_hash computed by the caller
 //
 // --- HIGHER LEVEL LOOKUP
 //	   sjson_get_int			Gets an integer value from a child of the specified parent node, sets to 'default_val' if node is not found
@@ -117,9 +135,13 @@
 //          - sjson_snprintf
 //		 MEMORY 
 //			- sjson_memcpy
+//			- sjson_memmove
 //			- sjson_memset
 //			- sjson_out_of_memory			happens when sjson cannot allocate memory internally
 //											Default behaviour is that it asserts and exits the program
+//		 SIMD
+//			- SJSON_NO_SIMD					define to always scan strings and whitespace one byte at a time
+//			- SJSON_NO_AVX2					define to use SSE2 on x86 even if the cpu has AVX2
 //	   Example:
 //			#define SJSON_IMPLEMENTATION
 //			#define sjson_malloc(user, size)			MyMalloc(user, size)
@@ -164,6 +186,7 @@ typedef unsigned char _Bool;
 #   include <stdbool.h>
 #endif
 #include <stddef.h>
+#include <stdint.h>
 
 // Json DOM object type
 typedef enum sjson_tag {
@@ -175,6 +198,31 @@ typedef enum sjson_tag {
     SJSON_OBJECT,
 } sjson_tag;
 
+// Objects with fewer members than this are searched linearly
+#ifndef SJSON_MEMBER_INDEX_MIN
+#   define SJSON_MEMBER_INDEX_MIN 8
+#endif
+
+// Words of sjson_decode_tape: the tag character in the top 8 bits, the payload in the low 56 bits
+//	'{' '['		index of the word after the matching close
+//	'}' ']'		index of the matching open
+//	'"' '\\'	string (keys too), '\\' if it contains escapes. Offset of its first byte after the quote
+//				from json in the low 32 bits, raw length in the next 24 bits
+//	'0'			number, offset and length of its text like strings
+//	't' 'f' 'n'	true, false, null
+#define SJSON_TAPE_WORD(tag, payload)	(((uint64_t)(unsigned char)(tag) << 56) | (uint64_t)(payload))
+#define SJSON_TAPE_TAG(w)				((char)((w) >> 56))
+#define SJSON_TAPE_OFFSET(w)			((uint32_t)(w))
+#define SJSON_TAPE_LEN(w)				((uint32_t)((w) >> 32) & 0xFFFFFF)
+
+// Slot of an object key hash table, node is NULL if empty
+typedef struct sjson__member_slot
+{
+    uint32_t 		   hash;
+    int 			   len;
+    struct sjson_node* node;
+} sjson__member_slot;
+
 // Json DOM node struct
 typedef struct sjson_node
 {
@@ -185,6 +233,11 @@ typedef struct sjson_node
     char* key;                 // only if parent is an object (NULL otherwise). Must be valid UTF-8. 
     
     sjson_tag tag;
+    int count;                 // number of children (SJSON_ARRAY, SJSON_OBJECT)
+    union {
+        struct sjson_node** index;          // SJSON_ARRAY: contiguous child table (sjson_index_arrays)
+        struct sjson__member_slot* members; // SJSON_OBJECT: key hash table (sjson_index_objects)
+    };
     union {
         bool bool_;     // SJSON_BOOL
         char* string_;  // SJSON_STRING: Must be valid UTF-8. 
@@ -226,6 +279,13 @@ typedef struct sjson_context
     sjson__str_page*  str_pages;
     sjson__str_page*  cur_str_page;
     char*			  cur_str;
+    bool			  index_arrays;
+    bool			  index_objects;
+    bool			  insitu;			// set while sjson_decode_insitu runs
+    uint64_t*		  tape;				// words of the last sjson_decode_tape
+    int				  tape_count;
+    int				  tape_cap;
+    const char*		  tape_base;		// set while sjson_decode_tape runs, tape offsets are relative to it
 } sjson_context;
 
 #ifdef __cplusplus
@@ -235,9 +295,13 @@ extern "C" {
 sjson_context* sjson_create_context(int pool_size, int str_buffer_size, void* alloc_user);
 void 		   sjson_destroy_context(sjson_context* ctx);
 void 		   sjson_reset_context(sjson_context* ctx);
+void 		   sjson_index_arrays(sjson_context* ctx, bool enable);
+void 		   sjson_index_objects(sjson_context* ctx, bool enable);
 
 // Encoding, decoding, and validation 
 sjson_node* sjson_decode(sjson_context* ctx, const char* json);
+sjson_node* sjson_decode_insitu(sjson_context* ctx, char* json);
+const uint64_t* sjson_decode_tape(sjson_context* ctx, const char* json, int len, int* count);
 char*	    sjson_encode(sjson_context* ctx, const sjson_node* node);
 char*	    sjson_encode_string(sjson_context* ctx, const char* str);
 char*	    sjson_stringify(sjson_context* ctx, const sjson_node* node, const char* space);
@@ -249,7 +313,10 @@ bool	    sjson_validate(sjson_context* ctx, const char* json);
 sjson_node* sjson_find_element(sjson_node* array, int index);
 sjson_node* sjson_find_member(sjson_node* object, const char* key);
 sjson_node* sjson_find_member_nocase(sjson_node* object, const char *name);
+sjson_node* sjson_find_member_hashed(sjson_node* object, const char* key, int len, uint32_t hash);
+uint32_t    sjson_key_hash(const char* key, int len);
 sjson_node* sjson_first_child(const sjson_node* node);
+sjson_node* sjson_last_child(const sjson_node* node);
 int         sjson_child_count(const sjson_node* node);
 
 // Higher level lookup/get functions
@@ -269,6 +336,11 @@ bool        sjson_get_uint16s(uint16_t* out, int count, sjson_node* parent, cons
          (i) != NULL;                                \
          (i) = (i)->next)
 
+#define sjson_foreach_reverse(i, object_or_array)    \
+    for ((i) = sjson_last_child(object_or_array);    \
+         (i) != NULL;                                \
+         (i) = (i)->prev)
+
 // Construction and manipulation 
 sjson_node* sjson_mknull(sjson_context* ctx);
 sjson_node* sjson_mkbool(sjson_context* ctx, bool b);
@@ -385,6 +457,21 @@ bool sjson_check(const sjson_node* node, char errmsg[256]);
 #	define sjson_memcpy(_a, _b, _n)		 memcpy(_a, _b, _n)
 #endif
 
+#ifndef sjson_memmove
+#	include <string.h>
+#	define sjson_memmove(_a, _b, _n)	 memmove(_a, _b, _n)
+#endif
+
+#ifndef sjson_memcmp
+#	include <string.h>
+#	define sjson_memcmp(_a, _b, _n)		 memcmp(_a, _b, _n)
+#endif
+
+#ifndef sjson_strncmp
+#	include <string.h>
+#	define sjson_strncmp(_a, _b, _n)	 strncmp(_a, _b, _n)
+#endif
+
 #ifndef sjson_stricmp
 #	ifdef _WIN32
 #		include <string.h>
@@ -538,7 +625,7 @@ static inline bool sjson__page_valid(const sjson__node_page* page, sjson_node* p
 {
     uintptr_t uptr = (uintptr_t)ptr;
     bool inbuf = uptr >= (uintptr_t)page->buff && 
-                 uptr < (uintptr_t)(page->buff + page->capacity*sizeof(sjson_node));
+                 uptr < (uintptr_t)(page->buff + page->capacity);
     bool valid = (uintptr_t)((uint8_t*)ptr - (uint8_t*)page->buff) % sizeof(sjson_node) == 0;
     return inbuf & valid;
 }
@@ -685,6 +772,8 @@ void sjson_destroy_context(sjson_context* ctx)
         spage = next;
     }
 
+    if (ctx->tape)
+        sjson_free(ctx->alloc_user, ctx->tape);
     sjson_free(ctx->alloc_user, ctx);
 }
 
@@ -706,6 +795,16 @@ void sjson_reset_context(sjson_context* ctx)
     // TODO: maybe we can reverse the linked-lists to get better cache coherency
 }
 
+void sjson_index_arrays(sjson_context* ctx, bool enable)
+{
+    ctx->index_arrays = enable;
+}
+
+void sjson_index_objects(sjson_context* ctx, bool enable)
+{
+    ctx->index_objects = enable;
+}
+
 static inline sjson_node* sjson__new_node(sjson_context* ctx, sjson_tag tag)
 {
     sjson__node_page* npage = ctx->node_pages;
@@ -741,7 +840,7 @@ static inline char* sjson__str_begin(sjson_context* ctx, int init_sz)
 
     // find a page that can grow to requested size
     sjson__str_page* spage = ctx->str_pages;
-    while (spage && (spage->offset + init_sz) <= spage->size)
+    while (spage && (spage->offset + init_sz) > spage->size)
         spage = spage->next;
 
     // create a new string page
@@ -783,21 +882,26 @@ static inline char* sjson__str_grow(sjson_context* ctx, int grow_sz)
             page_sz = total_sz > page_sz ? total_sz : page_sz;
         }
 
-        sjson__str_page* newspage = sjson__str_page_create(ctx->alloc_user, page_sz);
-        sjson_assert(newspage);
-        sjson_assert(total_sz <= newspage->size);
-        char* ptr = sjson__str_page_startptr(newspage);
+        // move the string to another page that still has room (pages are kept over sjson_reset_context)
+        sjson__str_page* newspage = ctx->str_pages;
+        while (newspage && (newspage == spage || newspage->offset + total_sz > newspage->size))
+            newspage = newspage->next;
+
+        if (newspage == NULL) {
+            newspage = sjson__str_page_create(ctx->alloc_user, page_sz);
+            sjson_assert(newspage);
+            sjson_assert(total_sz <= newspage->size);
+            sjson__str_page_add_list(&ctx->str_pages, newspage);
+        }
+        char* ptr = sjson__str_page_ptr(newspage);
         newspage->offset += total_sz;
 
         // copy previous buffer into the new one
         if (cur_str_sz > 0)
             sjson_memcpy(ptr, ctx->cur_str, cur_str_sz);
 
-        // check and see if we can remove the old page completely
-        if (ctx->cur_str == sjson__str_page_startptr(spage)) {
-            sjson__str_page_remove_list(&ctx->str_pages, spage);
-            sjson__str_page_destroy(spage, ctx->alloc_user);
-        }
+        // give back the old reservation, the page stays in the list for later strings
+        spage->offset -= cur_str_sz;
             
         ctx->cur_str_page = newspage;
         ctx->cur_str = ptr;
@@ -814,6 +918,25 @@ static inline char* sjson__str_end(sjson_context* ctx)
     return ptr;
 }
 
+// Gives back the unused tail of the current string reservation, end points past the terminator
+static inline void sjson__str_trim(sjson_context* ctx, const char* end)
+{
+    sjson__str_page* spage = ctx->cur_str_page;
+    sjson_assert (spage && "Should call sjson__str_begin before trim");
+    spage->offset = (int)(uintptr_t)(end - sjson__str_page_startptr(spage));
+}
+
+// Pointer-aligned block from the string pages, lives as long as the strings do
+static void* sjson__str_alloc(sjson_context* ctx, int size)
+{
+    const uintptr_t mask = sizeof(void*) - 1;
+    char* ptr = sjson__str_begin(ctx, size + (int)mask);
+    char* aligned = (char*)(((uintptr_t)ptr + mask) & ~mask);
+    sjson__str_trim(ctx, aligned + size);
+    sjson__str_end(ctx);
+    return aligned;
+}
+
 static char* sjson__strdup(sjson_context* ctx, const char *str)
 {
     int len = (int)sjson_strlen(str);
@@ -858,6 +981,226 @@ typedef uint32_t json__uchar_t;
  *  * The sixty-six Unicode "non-characters" are permitted
  *    (namely, U+FDD0..U+FDEF, U+xxFFFE, and U+xxFFFF).
  */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scanners
+//	sjson__scan_string	returns the first byte that is '"', '\\', a control character or not ASCII
+//	sjson__scan_space	returns the first byte that is not json whitespace
+// Both stop at the terminating NUL. The vector versions read whole blocks and can read past the NUL,
+// but a block that would cross into the next page is done byte by byte instead. The implementation is picked on the first call:
+// AVX2 if the cpu has it, SSE2 on x86, NEON on AArch64, plain C everywhere else
+#if !defined(SJSON_NO_SIMD) && defined(__GNUC__)
+#	if defined(__SSE2__)
+#		define SJSON__SSE2 1
+#		include <emmintrin.h>
+#		if !defined(SJSON_NO_AVX2) && (defined(__clang__) || __GNUC__ >= 5)
+#			define SJSON__AVX2 1
+#			include <immintrin.h>
+#		endif
+#	elif defined(__aarch64__) && defined(__ARM_NEON)
+#		define SJSON__NEON 1
+#		include <arm_neon.h>
+#	endif
+#endif
+// SJSON_NEON_EMULATION names a header that emulates the NEON intrinsics used below, so the NEON scanners
+// can be built and tested on other cpus (tests/test_scan.c). They are still only picked on AArch64.
+#if defined(SJSON_NEON_EMULATION) && !defined(SJSON__NEON)
+#	define SJSON__NEON 1
+#	define SJSON__NEON_EMULATED 1
+#	include SJSON_NEON_EMULATION
+#endif
+
+#define sjson__is_space(c) ((c) == '\t' || (c) == '\n' || (c) == '\r' || (c) == ' ')
+#define sjson__is_digit(c) ((c) >= '0' && (c) <= '9')
+#define sjson__is_plain(c) ((unsigned char)(c) >= 0x20 && (unsigned char)(c) < 0x80 && (c) != '"' && (c) != '\\')
+#define sjson__page_cross(_p, _n) (((uintptr_t)(_p) & 4095) > 4096 - (_n))
+
+static inline const char* sjson__scan_string_c(const char* s)
+{
+    while (sjson__is_plain(*s))
+        s++;
+    return s;
+}
+
+static inline const char* sjson__scan_space_c(const char* s)
+{
+    while (sjson__is_space(*s))
+        s++;
+    return s;
+}
+
+#if SJSON__SSE2
+static const char* sjson__scan_string_sse2(const char* s)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i bslash = _mm_set1_epi8('\\');
+    const __m128i space = _mm_set1_epi8(0x20);
+    
+    for (;;) {
+        if (sjson__page_cross(s, 16)) {
+            if (!sjson__is_plain(*s))
+                return s;
+            s++;
+            continue;
+        }
+        __m128i v = _mm_loadu_si128((const __m128i*)s);
+        // signed compare, so bytes >= 0x80 are below 0x20 too
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash)),
+                                 _mm_cmplt_epi8(v, space));
+        unsigned mask = (unsigned)_mm_movemask_epi8(m);
+        if (mask)
+            return s + __builtin_ctz(mask);
+        s += 16;
+    }
+}
+
+static const char* sjson__scan_space_sse2(const char* s)
+{
+    for (;;) {
+        if (sjson__page_cross(s, 16)) {
+            if (!sjson__is_space(*s))
+                return s;
+            s++;
+            continue;
+        }
+        __m128i v = _mm_loadu_si128((const __m128i*)s);
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                                 _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+        unsigned mask = ~(unsigned)_mm_movemask_epi8(m) & 0xFFFF;
+        if (mask)
+            return s + __builtin_ctz(mask);
+        s += 16;
+    }
+}
+#endif // SJSON__SSE2
+
+#if SJSON__AVX2
+__attribute__((target("avx2")))
+static const char* sjson__scan_string_avx2(const char* s)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i bslash = _mm256_set1_epi8('\\');
+    const __m256i space = _mm256_set1_epi8(0x20);
+    
+    for (;;) {
+        if (sjson__page_cross(s, 32)) {
+            if (!sjson__is_plain(*s))
+                return s;
+            s++;
+            continue;
+        }
+        __m256i v = _mm256_loadu_si256((const __m256i*)s);
+        __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, bslash)),
+                                    _mm256_cmpgt_epi8(space, v));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(m);
+        if (mask)
+            return s + __builtin_ctz(mask);
+        s += 32;
+    }
+}
+
+__attribute__((target("avx2")))
+static const char* sjson__scan_space_avx2(const char* s)
+{
+    for (;;) {
+        if (sjson__page_cross(s, 32)) {
+            if (!sjson__is_space(*s))
+                return s;
+            s++;
+            continue;
+        }
+        __m256i v = _mm256_loadu_si256((const __m256i*)s);
+        __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+                                    _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+        unsigned mask = ~(unsigned)_mm256_movemask_epi8(m);
+        if (mask)
+            return s + __builtin_ctz(mask);
+        s += 32;
+    }
+}
+#endif // SJSON__AVX2
+
+#if SJSON__NEON
+static const char* sjson__scan_string_neon(const char* s)
+{
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t bslash = vdupq_n_u8('\\');
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t high = vdupq_n_u8(0x80);
+    
+    for (;;) {
+        if (sjson__page_cross(s, 16)) {
+            if (!sjson__is_plain(*s))
+                return s;
+            s++;
+            continue;
+        }
+        uint8x16_t v = vld1q_u8((const uint8_t*)s);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, bslash)),
+                                vorrq_u8(vcltq_u8(v, space), vcgeq_u8(v, high)));
+        if (vmaxvq_u8(m))
+            return sjson__scan_string_c(s);
+        s += 16;
+    }
+}
+
+static const char* sjson__scan_space_neon(const char* s)
+{
+    for (;;) {
+        if (sjson__page_cross(s, 16)) {
+            if (!sjson__is_space(*s))
+                return s;
+            s++;
+            continue;
+        }
+        uint8x16_t v = vld1q_u8((const uint8_t*)s);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t'))),
+                                vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8('\r'))));
+        if (vminvq_u8(m) == 0)
+            return sjson__scan_space_c(s);
+        s += 16;
+    }
+}
+#endif // SJSON__NEON
+
+static const char* sjson__scan_string_init(const char* s);
+static const char* sjson__scan_space_init(const char* s);
+static const char* (*sjson__scan_string)(const char* s) = sjson__scan_string_init;
+static const char* (*sjson__scan_space)(const char* s) = sjson__scan_space_init;
+
+static void sjson__select_scanners(void)
+{
+#if SJSON__AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        sjson__scan_string = sjson__scan_string_avx2;
+        sjson__scan_space = sjson__scan_space_avx2;
+        return;
+    }
+#endif
+#if SJSON__SSE2
+    sjson__scan_string = sjson__scan_string_sse2;
+    sjson__scan_space = sjson__scan_space_sse2;
+#elif SJSON__NEON && !SJSON__NEON_EMULATED
+    sjson__scan_string = sjson__scan_string_neon;
+    sjson__scan_space = sjson__scan_space_neon;
+#else
+    sjson__scan_string = sjson__scan_string_c;
+    sjson__scan_space = sjson__scan_space_c;
+#endif
+}
+
+static const char* sjson__scan_string_init(const char* s)
+{
+    sjson__select_scanners();
+    return sjson__scan_string(s);
+}
+
+static const char* sjson__scan_space_init(const char* s)
+{
+    sjson__select_scanners();
+    return sjson__scan_space(s);
+}
+
 static int sjson__utf8_validate_cz(const char *s)
 {
     unsigned char c = *s++;
@@ -918,6 +1261,9 @@ static bool sjson__utf8_validate(const char *s)
     int len;
     
     for (; *s != 0; s += len) {
+        s = sjson__scan_string(s);
+        if (*s == 0)
+            break;
         len = sjson__utf8_validate_cz(s);
         if (len == 0)
             return false;
@@ -1035,15 +1381,13 @@ static void sjson__to_surrogate_pair(json__uchar_t unicode, uint16_t *uc, uint16
     *lc = (n & 0x3FF) | 0xDC00;
 }
 
-#define sjson__is_space(c) ((c) == '\t' || (c) == '\n' || (c) == '\r' || (c) == ' ')
-#define sjson__is_digit(c) ((c) >= '0' && (c) <= '9')
-
 static bool sjson__parse_value(sjson_context* ctx, const char **sp, sjson_node **out);
 static bool sjson__parse_string(sjson_context* ctx, const char **sp, char **out);
 static bool sjson__parse_number(const char **sp, double *out);
 static bool sjson__parse_array(sjson_context* ctx, const char **sp, sjson_node **out);
 static bool sjson__parse_object(sjson_context* ctx, const char **sp, sjson_node **out);
 static bool sjson__parse_hex16(const char **sp, uint16_t         *out);
+static bool sjson__tape_push(sjson_context* ctx, char tag, uint64_t payload);
 
 static bool sjson__expect_literal(const char **sp, const char *str);
 static void sjson__skip_space(const char **sp);
@@ -1085,6 +1429,70 @@ sjson_node *sjson_decode(sjson_context* ctx, const char *json)
     return ret;
 }
 
+sjson_node *sjson_decode_insitu(sjson_context* ctx, char *json)
+{
+    sjson_node *ret;
+    
+    ctx->insitu = true;
+    ret = sjson_decode(ctx, json);
+    ctx->insitu = false;
+    return ret;
+}
+
+const uint64_t* sjson_decode_tape(sjson_context* ctx, const char* json, int len, int* count)
+{
+    const char *s = json;
+    const char *end = json + len;
+    bool ok;
+    
+    /* Offsets and lengths must fit in the word, see SJSON_TAPE_WORD */
+    if (len < 0 || len >= (1 << 24))
+        return NULL;
+    
+    /* Reserve about one word per 8 bytes so typical documents never grow the array */
+    if (ctx->tape_cap < len / 8 + 16) {
+        int cap = ctx->tape_cap * 2 > len / 8 + 16 ? ctx->tape_cap * 2 : len / 8 + 16;
+        uint64_t* tape = (uint64_t*)sjson_realloc(ctx->alloc_user, ctx->tape, sizeof(uint64_t) * cap);
+        if (!tape) {
+            sjson_out_of_memory();
+            return NULL;
+        }
+        ctx->tape = tape;
+        ctx->tape_cap = cap;
+    }
+    
+    ctx->tape_count = 0;
+    ctx->tape_base = json;
+    sjson__skip_space(&s);
+    ok = sjson__parse_value(ctx, &s, NULL);
+    ctx->tape_base = NULL;
+    
+    /* The value must end inside json, only spaces may follow it */
+    while (ok && s < end && sjson__is_space(*s))
+        s++;
+    if (!ok || s != end)
+        return NULL;
+    
+    *count = ctx->tape_count;
+    return ctx->tape;
+}
+
+static bool sjson__tape_push(sjson_context* ctx, char tag, uint64_t payload)
+{
+    if (ctx->tape_count == ctx->tape_cap) {
+        int cap = ctx->tape_cap * 2;
+        uint64_t* tape = (uint64_t*)sjson_realloc(ctx->alloc_user, ctx->tape, sizeof(uint64_t) * cap);
+        if (!tape) {
+            sjson_out_of_memory();
+            return false;
+        }
+        ctx->tape = tape;
+        ctx->tape_cap = cap;
+    }
+    ctx->tape[ctx->tape_count++] = SJSON_TAPE_WORD(tag, payload);
+    return true;
+}
+
 char* sjson_encode(sjson_context* ctx, const sjson_node *node)
 {
     return sjson_stringify(ctx, node, NULL);
@@ -1164,6 +1572,9 @@ sjson_node *sjson_find_element(sjson_node *array, int index)
     if (array == NULL || array->tag != SJSON_ARRAY)
         return NULL;
     
+    if (array->index)
+        return (index >= 0 && index < array->count) ? array->index[index] : NULL;
+    
     sjson_foreach(element, array) {
         if (i == index)
             return element;
@@ -1173,6 +1584,78 @@ sjson_node *sjson_find_element(sjson_node *array, int index)
     return NULL;
 }
 
+// FNV-1a
+uint32_t sjson_key_hash(const char* key, int len)
+{
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (uint8_t)key[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Power of two with at most half of the slots in use
+static inline int sjson__member_table_size(int count)
+{
+    int size = 16;
+    while (size < count * 2)
+        size <<= 1;
+    return size;
+}
+
+// Builds the key hash table of an object, duplicate keys keep the first member like the linear search
+static void sjson__index_members(sjson_context* ctx, sjson_node* object)
+{
+    int size = sjson__member_table_size(object->count);
+    int mask = size - 1;
+    sjson__member_slot* members = (sjson__member_slot*)sjson__str_alloc(ctx, (int)sizeof(sjson__member_slot) * size);
+    sjson_node* member;
+    
+    sjson_memset(members, 0x0, sizeof(sjson__member_slot) * size);
+    sjson_foreach(member, object) {
+        int len = (int)sjson_strlen(member->key);
+        uint32_t hash = sjson_key_hash(member->key, len);
+        int i = (int)hash & mask;
+        while (members[i].node != NULL) {
+            if (members[i].hash == hash && members[i].len == len && sjson_memcmp(members[i].node->key, member->key, len) == 0)
+                break;
+            i = (i + 1) & mask;
+        }
+        if (members[i].node == NULL) {
+            members[i].hash = hash;
+            members[i].len = len;
+            members[i].node = member;
+        }
+    }
+    object->members = members;
+}
+
+sjson_node* sjson_find_member_hashed(sjson_node* object, const char* key, int len, uint32_t hash)
+{
+    sjson_node *member;
+    
+    if (object == NULL || object->tag != SJSON_OBJECT)
+        return NULL;
+    
+    if (object->members) {
+        int mask = sjson__member_table_size(object->count) - 1;
+        for (int i = (int)hash & mask;; i = (i + 1) & mask) {
+            const sjson__member_slot* slot = &object->members[i];
+            if (slot->node == NULL)
+                return NULL;
+            if (slot->hash == hash && slot->len == len && sjson_memcmp(slot->node->key, key, len) == 0)
+                return slot->node;
+        }
+    }
+    
+    sjson_foreach(member, object)
+        if (sjson_strncmp(member->key, key, len) == 0 && member->key[len] == '\0')
+            return member;
+    
+    return NULL;
+}
+
 sjson_node *sjson_find_member(sjson_node *object, const char *name)
 {
     sjson_node *member;
@@ -1180,6 +1663,11 @@ sjson_node *sjson_find_member(sjson_node *object, const char *name)
     if (object == NULL || object->tag != SJSON_OBJECT)
         return NULL;
     
+    if (object->members) {
+        int len = (int)sjson_strlen(name);
+        return sjson_find_member_hashed(object, name, len, sjson_key_hash(name, len));
+    }
+    
     sjson_foreach(member, object)
         if (sjson_strcmp(member->key, name) == 0)
             return member;
@@ -1208,12 +1696,18 @@ sjson_node *sjson_first_child(const sjson_node *node)
     return NULL;
 }
 
+sjson_node *sjson_last_child(const sjson_node *node)
+{
+    if (node != NULL && (node->tag == SJSON_ARRAY || node->tag == SJSON_OBJECT))
+        return node->children.tail;
+    return NULL;
+}
+
 int sjson_child_count(const sjson_node* node)
 {
-    int count = 0;
-    sjson_node* item;
-    sjson_foreach(item, node) ++count;
-    return count;
+    if (node != NULL && (node->tag == SJSON_ARRAY || node->tag == SJSON_OBJECT))
+        return node->count;
+    return 0;
 }
 
 
@@ -1395,6 +1889,8 @@ sjson_node *sjson_mkobject(sjson_context* ctx)
 
 static void sjson__append_node(sjson_node *parent, sjson_node *child)
 {
+    parent->count++;
+    parent->index = NULL;
     child->parent = parent;
     child->prev = parent->children.tail;
     child->next = NULL;
@@ -1408,6 +1904,8 @@ static void sjson__append_node(sjson_node *parent, sjson_node *child)
 
 static void sjson__prepend_node(sjson_node *parent, sjson_node *child)
 {
+    parent->count++;
+    parent->index = NULL;
     child->parent = parent;
     child->prev = NULL;
     child->next = parent->children.head;
@@ -1463,6 +1961,8 @@ void sjson_remove_from_parent(sjson_node *node)
     sjson_node *parent = node->parent;
     
     if (parent != NULL) {
+        parent->count--;
+        parent->index = NULL;
         if (node->prev != NULL)
             node->prev->next = node->next;
         else
@@ -1619,6 +2119,8 @@ static bool sjson__parse_value(sjson_context* ctx, const char **sp, sjson_node *
             if (sjson__expect_literal(&s, "null")) {
                 if (out)
                     *out = sjson_mknull(ctx);
+                else if (ctx->tape_base && !sjson__tape_push(ctx, 'n', 0))
+                    return false;
                 *sp = s;
                 return true;
             }
@@ -1628,6 +2130,8 @@ static bool sjson__parse_value(sjson_context* ctx, const char **sp, sjson_node *
             if (sjson__expect_literal(&s, "false")) {
                 if (out)
                     *out = sjson_mkbool(ctx, false);
+                else if (ctx->tape_base && !sjson__tape_push(ctx, 'f', 0))
+                    return false;
                 *sp = s;
                 return true;
             }
@@ -1637,6 +2141,8 @@ static bool sjson__parse_value(sjson_context* ctx, const char **sp, sjson_node *
             if (sjson__expect_literal(&s, "true")) {
                 if (out)
                     *out = sjson_mkbool(ctx, true);
+                else if (ctx->tape_base && !sjson__tape_push(ctx, 't', 0))
+                    return false;
                 *sp = s;
                 return true;
             }
@@ -1672,6 +2178,9 @@ static bool sjson__parse_value(sjson_context* ctx, const char **sp, sjson_node *
             if (sjson__parse_number(&s, out ? &num : NULL)) {
                 if (out)
                     *out = sjson_mknumber(ctx, num);
+                else if (ctx->tape_base && !sjson__tape_push(ctx, '0',
+                        (uint64_t)(s - *sp) << 32 | (uint64_t)(*sp - ctx->tape_base)))
+                    return false;
                 *sp = s;
                 return true;
             }
@@ -1685,9 +2194,12 @@ static bool sjson__parse_array(sjson_context* ctx, const char **sp, sjson_node *
     const char *s = *sp;
     sjson_node *ret = out ? sjson_mkarray(ctx) : NULL;
     sjson_node *element;
+    int open = ctx->tape_count;
     
     if (*s++ != '[')
         goto failure;
+    if (!out && ctx->tape_base && !sjson__tape_push(ctx, '[', 0))
+        goto failure;
     sjson__skip_space(&s);
     
     if (*s == ']') {
@@ -1715,8 +2227,21 @@ static bool sjson__parse_array(sjson_context* ctx, const char **sp, sjson_node *
     
 success:
     *sp = s;
-    if (out)
+    if (!out && ctx->tape_base) {
+        if (!sjson__tape_push(ctx, ']', (uint64_t)open))
+            return false;
+        ctx->tape[open] |= (uint64_t)ctx->tape_count;
+    }
+    if (out) {
+        if (ctx->index_arrays && ret->count > 0) {
+            sjson_node** index = (sjson_node**)sjson__str_alloc(ctx, (int)sizeof(sjson_node*) * ret->count);
+            int i = 0;
+            sjson_foreach(element, ret)
+                index[i++] = element;
+            ret->index = index;
+        }
         *out = ret;
+    }
     return true;
 
 failure:
@@ -1730,9 +2255,12 @@ static bool sjson__parse_object(sjson_context* ctx, const char **sp, sjson_node
     sjson_node *ret = out ? sjson_mkobject(ctx) : NULL;
     char *key;
     sjson_node *value;
+    int open = ctx->tape_count;
     
     if (*s++ != '{')
         goto failure;
+    if (!out && ctx->tape_base && !sjson__tape_push(ctx, '{', 0))
+        goto failure;
     sjson__skip_space(&s);
     
     if (*s == '}') {
@@ -1768,8 +2296,16 @@ static bool sjson__parse_object(sjson_context* ctx, const char **sp, sjson_node
     
 success:
     *sp = s;
-    if (out)
+    if (!out && ctx->tape_base) {
+        if (!sjson__tape_push(ctx, '}', (uint64_t)open))
+            return false;
+        ctx->tape[open] |= (uint64_t)ctx->tape_count;
+    }
+    if (out) {
+        if (ctx->index_objects && ret->count >= SJSON_MEMBER_INDEX_MIN)
+            sjson__index_members(ctx, ret);
         *out = ret;
+    }
     return true;
 
 failure_free_key:
@@ -1784,11 +2320,16 @@ static bool sjson__parse_string(sjson_context* ctx, const char **sp, char **out)
     char throwaway_buffer[4]; /* enough space for a UTF-8 character */
     char* b;
     char* src = NULL;
+    bool escaped = false;
 
     if (*s++ != '"')
         return false;
     
-    if (out) {
+    if (out && ctx->insitu) {
+        /* The output never gets longer than the escaped input, write it over the input */
+        b = (char*)s;
+        src = b;
+    } else if (out) {
         b = sjson__str_begin(ctx, 4);
         src = b;
     } else {
@@ -1796,10 +2337,30 @@ static bool sjson__parse_string(sjson_context* ctx, const char **sp, char **out)
     }
     
     while (*s != '"') {
+        /* Copy a run of plain ASCII at once. */
+        if (sjson__is_plain(*s)) {
+            const char* run = sjson__scan_string(s + 1);
+            int n = (int)(uintptr_t)(run - s);
+            if (out && ctx->insitu) {
+                if (b != s)
+                    sjson_memmove(b, s, n);
+                b += n;
+            } else if (out) {
+                int offset = (int)(uintptr_t)(b - src);
+                src = sjson__str_grow(ctx, n);
+                b = src + offset;
+                sjson_memcpy(b, s, n);
+                b += n;
+            }
+            s = run;
+            continue;
+        }
+        
         unsigned char c = *s++;
         
         /* Parse next character, and write it to b. */
         if (c == '\\') {
+            escaped = true;
             c = *s++;
             switch (c) {
                 case '"':
@@ -1862,15 +2423,23 @@ static bool sjson__parse_string(sjson_context* ctx, const char **sp, char **out)
             if (len == 0)
                 goto failed; /* Invalid UTF-8 character. */
 
-            while (len--)
-                *b++ = *s++;
+            if (b == s) {
+                /* In-situ and no escape seen yet, the bytes are already in place */
+                b += len;
+                s += len;
+            } else {
+                while (len--)
+                    *b++ = *s++;
+            }
         }
         
         /*
          * Update sb to know about the new bytes,
          * and set up b to write another character.
          */
-        if (out) {
+        if (out && ctx->insitu) {
+            continue;
+        } else if (out) {
             int offset = (int)(uintptr_t)(b - src);
             src = sjson__str_grow(ctx, 4);
             b = src + offset;
@@ -1880,15 +2449,24 @@ static bool sjson__parse_string(sjson_context* ctx, const char **sp, char **out)
     }
     s++;
     
-    if (out) {
+    if (out && ctx->insitu) {
+        *b = '\0';
+        *out = src;
+    } else if (out) {
         *b = '\0';
+        sjson__str_trim(ctx, b + 1);
         *out = sjson__str_end(ctx);
+    } else if (ctx->tape_base) {
+        const char* first = *sp + 1;
+        if (!sjson__tape_push(ctx, escaped ? '\\' : '"',
+                (uint64_t)(s - 1 - first) << 32 | (uint64_t)(first - ctx->tape_base)))
+            return false;
     }
     *sp = s;
     return true;
 
 failed:
-    if (out)
+    if (out && !ctx->insitu)
         sjson__str_end(ctx);
     return false;
 }
@@ -1954,8 +2532,9 @@ bool sjson__parse_number(const char **sp, double *out)
 static void sjson__skip_space(const char **sp)
 {
     const char *s = *sp;
-    while (sjson__is_space(*s))
-        s++;
+    // compact json has no whitespace at all, don't pay for a call then
+    if (sjson__is_space(*s))
+        s = sjson__scan_space(s + 1);
     *sp = s;
 }
 
@@ -0,0 +1,164 @@
+#include <string.h>
+#include "sse.h"
+
+static int sse_reserve(struct nano_sse_parser *p, size_t n);
+static void sse_dispatch(struct nano_sse_parser *p);
+static void sse_process_line(struct nano_sse_parser *p, size_t line, size_t end);
+
+void nano_sse_init(struct nano_sse_parser *p, nano_sse_handler handler, void *user)
+{
+	memset(p, 0, sizeof(*p));
+	p->retry_ms = -1;
+	p->handler = handler;
+	p->user = user;
+}
+
+void nano_sse_reset(struct nano_sse_parser *p)
+{
+	p->len = p->start = p->line = p->scan = 0;
+	p->skip_lf = 0;
+	p->type[0] = 0;
+	p->has_data = 0;
+	p->data_off = p->data_len = 0;
+}
+
+void nano_sse_free(struct nano_sse_parser *p)
+{
+	free(p->buf);
+	p->buf = NULL;
+	p->cap = 0;
+	nano_sse_reset(p);
+}
+
+// n バイト追記できるようにする(処理済み部分を詰めるか、倍々に伸ばす)
+static int sse_reserve(struct nano_sse_parser *p, size_t n)
+{
+	// 処理済みの部分が半分以上を占めていれば詰めて再利用する
+	if(p->start > 0 && (p->start >= p->len / 2 || p->len + n + 1 > p->cap)) {
+		size_t d = p->start;
+		memmove(p->buf, p->buf + d, p->len - d);
+		p->len -= d;
+		p->line -= d;
+		p->scan -= d;
+		if(p->has_data) p->data_off -= d;
+		p->start = 0;
+	}
+
+	if(p->len + n + 1 > p->cap) {
+		size_t cap = p->cap ? p->cap : 4096;
+		while(cap < p->len + n + 1) cap *= 2;
+		char *b = realloc(p->buf, cap);
+		if(!b) return 0;
+		p->buf = b;
+		p->cap = cap;
+	}
+	return 1;
+}
+
+// 空行が来たのでイベントを確定させる
+static void sse_dispatch(struct nano_sse_parser *p)
+{
+	if(p->has_data) {
+		struct nano_sse_event ev;
+		p->buf[p->data_off + p->data_len] = 0;
+		ev.type = p->type[0] ? p->type : "message";
+		ev.data = p->buf + p->data_off;
+		ev.data_len = p->data_len;
+		ev.id = p->last_id;
+		p->events++;
+		if(p->handler) p->handler(&ev, p->user);
+	}
+	p->type[0] = 0;
+	p->has_data = 0;
+}
+
+// [line, end)の1行を処理する
+static void sse_process_line(struct nano_sse_parser *p, size_t line, size_t end)
+{
+	char *s = p->buf + line;
+	size_t n = end - line;
+
+	if(n == 0) {
+		sse_dispatch(p);
+		return;
+	}
+
+	// ':'で始まる行はコメント(接続維持用)
+	if(*s == ':') return;
+
+	// "field: value"に分解、':'が無ければ行全体がフィールド名
+	char *colon = memchr(s, ':', n);
+	size_t flen = colon ? (size_t)(colon - s) : n;
+	char *v = colon ? colon + 1 : s + n;
+	if(v < s + n && *v == ' ') v++;
+	size_t vlen = (s + n) - v;
+
+	if(flen == 4 && memcmp(s, "data", 4) == 0) {
+		size_t off = v - p->buf;
+		if(!p->has_data) {
+			p->data_off = off;
+			p->data_len = vlen;
+			p->has_data = 1;
+		} else {
+			// 複数行のdataは前の行の直後に詰めて連結する(移動先は常に手前)
+			char *dst = p->buf + p->data_off + p->data_len;
+			*dst++ = '\n';
+			memmove(dst, v, vlen);
+			p->data_len += 1 + vlen;
+		}
+	} else if(flen == 5 && memcmp(s, "event", 5) == 0) {
+		if(vlen >= sizeof(p->type)) vlen = sizeof(p->type) - 1;
+		memcpy(p->type, v, vlen);
+		p->type[vlen] = 0;
+	} else if(flen == 2 && memcmp(s, "id", 2) == 0) {
+		// NULを含むidは無視する
+		if(vlen < sizeof(p->last_id) && !memchr(v, 0, vlen)) {
+			memcpy(p->last_id, v, vlen);
+			p->last_id[vlen] = 0;
+		}
+	} else if(flen == 5 && memcmp(s, "retry", 5) == 0) {
+		long ms = 0;
+		size_t i;
+		for(i = 0; i < vlen && v[i] >= '0' && v[i] <= '9'; i++) ms = ms * 10 + (v[i] - '0');
+		if(i == vlen && vlen > 0) p->retry_ms = ms;
+	}
+	// それ以外のフィールドは無視
+}
+
+int nano_sse_feed(struct nano_sse_parser *p, const char *src, size_t n)
+{
+	if(!sse_reserve(p, n)) return 0;
+
+	memcpy(p->buf + p->len, src, n);
+	p->len += n;
+	p->buf[p->len] = 0;
+	p->bytes += n;
+
+	// 新しく届いた部分だけ行末(LF, CR, CRLF)を探す
+	size_t i = p->scan;
+	while(i < p->len) {
+		if(p->skip_lf) {
+			p->skip_lf = 0;
+			if(p->buf[i] == '\n') {
+				p->line = ++i;
+				if(!p->has_data) p->start = p->line;
+				continue;
+			}
+		}
+
+		char c = p->buf[i];
+		if(c != '\n' && c != '\r') {
+			i++;
+			continue;
+		}
+
+		p->buf[i] = 0;
+		if(c == '\r') p->skip_lf = 1;
+		sse_process_line(p, p->line, i);
+		p->line = ++i;
+		if(!p->has_data) p->start = p->line;
+	}
+	p->scan = i;
+
+	return 1;
+}
@@ -0,0 +1,55 @@
+#ifndef NANOTODON_SSE_H
+#define NANOTODON_SSE_H
+
+#include <stdlib.h>
+
+#define NANO_SSE_TYPE_LEN 64
+#define NANO_SSE_ID_LEN 128
+
+// 1イベント分の受信結果
+// type以外は受信バッファ内を直接指すので、ハンドラを抜けた後は無効になる
+struct nano_sse_event {
+	const char *type;	// イベント種別(event:が無ければ"message")
+	char *data;		// data:行を改行で連結したもの(NUL終端済み)
+	size_t data_len;
+	const char *id;		// 最後に受信したid:(無ければ空文字列)
+};
+
+typedef void (*nano_sse_handler)(struct nano_sse_event *ev, void *user);
+
+// Server-Sent Eventsのインクリメンタルパーサ
+struct nano_sse_parser {
+	char *buf;
+	size_t len;		// 受信済みバイト数
+	size_t cap;		// 確保済みバイト数
+	size_t start;		// 処理中イベントの先頭(これより前は捨ててよい)
+	size_t line;		// 処理中の行の先頭
+	size_t scan;		// 行末探索を再開する位置
+	int skip_lf;		// 直前の行がCRで終わった(CRLFのLFを読み飛ばす)
+
+	char type[NANO_SSE_TYPE_LEN];
+	int has_data;
+	size_t data_off;
+	size_t data_len;
+
+	char last_id[NANO_SSE_ID_LEN];
+	long retry_ms;		// retry:で指定された再接続待ち時間(未指定なら-1)
+
+	unsigned long long bytes;	// 受信バイト数
+	unsigned long long events;	// ハンドラに渡したイベント数
+
+	nano_sse_handler handler;
+	void *user;
+};
+
+void nano_sse_init(struct nano_sse_parser *p, nano_sse_handler handler, void *user);
+
+// 受信データを追加する、完結したイベントごとにhandlerが呼ばれる
+int nano_sse_feed(struct nano_sse_parser *p, const char *src, size_t n);
+
+// 接続し直す時に途中までのイベントを捨てる(last_idとretry_msは保持)
+void nano_sse_reset(struct nano_sse_parser *p);
+
+void nano_sse_free(struct nano_sse_parser *p);
+
+#endif
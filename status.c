@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <string.h>
+#include "status.h"
+#include "jsonpath.h"
+#include "html.h"
+
+const char *nano_status_str(struct nano_status *st, enum nano_status_field f, const char *def)
+{
+	return nano_tape_str(st->tape, st->field[f], def);
+}
+
+// tapeは複製済みのもの,ブースト元も同じtapeを指すようにする
+static struct nano_status *status_dup(const struct nano_status *st, struct nano_tape *tape, int borrowed)
+{
+	struct nano_status *d = malloc(sizeof(struct nano_status));
+	*d = *st;
+	d->id = strdup(st->id);
+	d->tape = tape;
+	d->borrowed = borrowed;
+	d->reblog = st->reblog ? status_dup(st->reblog, tape, 1) : NULL;
+	d->content = nano_html_dup(st->content);
+	return d;
+}
+
+struct nano_status *nano_status_dup(const struct nano_status *st)
+{
+	if(!st) return NULL;
+	return status_dup(st, nano_tape_dup(st->tape), 0);
+}
+
+void nano_status_free(struct nano_status *st)
+{
+	if(!st) return;
+	free(st->id);
+	nano_status_free(st->reblog);
+	nano_html_free(st->content);
+	if(!st->borrowed) free(st->tape);
+	free(st);
+}
+
+void nano_notification_free(struct nano_notification *n)
+{
+	if(!n) return;
+	free(n->type);
+	free(n->acct);
+	free(n->display_name);
+	nano_status_free(n->status);
+	free(n);
+}
+
+void nano_record_free(struct nano_record *rec)
+{
+	if(!rec) return;
+	switch(rec->kind) {
+	case NANO_RECORD_STATUS:
+	case NANO_RECORD_EDIT:
+		nano_status_free(rec->status);
+		break;
+	case NANO_RECORD_NOTIFICATION:
+		nano_notification_free(rec->notify);
+		break;
+	case NANO_RECORD_NOTICE:
+		free(rec->notice);
+		break;
+	case NANO_RECORD_DELETE:
+		free(rec->deleted_id);
+		break;
+	}
+	free(rec);
+}
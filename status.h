@@ -0,0 +1,74 @@
+#ifndef NANOTODON_STATUS_H
+#define NANOTODON_STATUS_H
+
+#include <stddef.h>
+#include <time.h>
+
+struct nano_tape;
+struct nano_html;
+
+// テープから読むTootのフィールド
+enum nano_status_field {
+	NANO_STATUS_ID,
+	NANO_STATUS_CREATED_AT,
+	NANO_STATUS_REBLOG,
+	NANO_STATUS_CONTENT,
+	NANO_STATUS_VISIBILITY,
+	NANO_STATUS_ACCT,
+	NANO_STATUS_DISPLAY_NAME,
+	NANO_STATUS_APP_NAME,
+	NANO_STATUS_MEDIA,
+	NANO_STATUS_FIELDS
+};
+
+// パース済みのToot
+// IDと日時以外のフィールド(アカウントや添付メディアなど)は表示するときにテープから読む,本文は変換済みのものを持つ
+struct nano_status {
+	char *id;
+	time_t created_at;
+	int created_ms;			// created_atの秒未満(ミリ秒)
+	struct nano_tape *tape;		// Toot全体(jsonpath.h)
+	size_t root;			// tapeの中でのこのTootの位置
+	size_t field[NANO_STATUS_FIELDS];	// 各フィールドの値のtapeでの位置(無ければNANO_TAPE_NONE)
+	int borrowed;			// tapeはブーストしたToot(親)のもので,解放しない
+	struct nano_status *reblog;	// ブーストならブースト元のToot
+	struct nano_html *content;	// 本文を表示用に変換したもの(html.h,ブーストならNULL,変換したらテープの本文は空にしてある)
+};
+
+// パース済みの通知
+struct nano_notification {
+	char *type;
+	char *acct;
+	char *display_name;
+	struct nano_status *status;	// 対象のToot(フォロー通知などではNULL)
+};
+
+enum nano_record_kind {
+	NANO_RECORD_STATUS,
+	NANO_RECORD_NOTIFICATION,
+	NANO_RECORD_NOTICE,
+	NANO_RECORD_DELETE,		// 表示済みのTootを消す
+	NANO_RECORD_EDIT,		// 表示済みのTootを編集後のものに差し替える
+};
+
+// パーサからUIへ渡すレコード
+struct nano_record {
+	enum nano_record_kind kind;
+	const char *stream;		// 追加購読したストリームの名前(メインのタイムラインならNULL,共有なので解放しない)
+	union {
+		struct nano_status *status;	// STATUS, EDIT
+		struct nano_notification *notify;
+		char *notice;
+		char *deleted_id;		// DELETE
+	};
+};
+
+// フィールドの文字列,無ければdef(ポインタはstが生きている間有効)
+const char *nano_status_str(struct nano_status *st, enum nano_status_field f, const char *def);
+
+struct nano_status *nano_status_dup(const struct nano_status *st);
+void nano_status_free(struct nano_status *st);
+void nano_notification_free(struct nano_notification *n);
+void nano_record_free(struct nano_record *rec);
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef NANOTODON_TESTS_COMMON_H
+#define NANOTODON_TESTS_COMMON_H
+
+// テスト(tests/*.c)とベンチマーク(bench/*.c)の共通部分
+// どちらもトップのディレクトリから動かして,tests/dataとbench/dataを読む
+//
+// COMMON_NANOTODONを定義してから取り込むと,nanotodon.cをmainをnanotodon_mainに変えて取り込み,
+// パーススレッドの状態を用意する関数も使えるようにする
+// (sjsonやcursesの関数を数える版に差し替えるものは,その定義をこれより前に置く)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+// 条件が成り立たなければFAILと理由を出して1を返す(テストの関数の中で使う)
+#define CHECK(cond, ...) do { if(!(cond)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; } } while(0)
+
+// ベンチマークの1つの計測を続ける最短の時間
+#define COMMON_MIN_NS 500000000ULL
+
+// 本体(...)をCOMMON_MIN_NS以上のあいだ繰り返す,passesに回数を,elapsedにナノ秒を足す
+#define COMMON_REPEAT(passes, elapsed, ...) do { \
+		uint64_t common_start_ = common_now(), common_t_; \
+		do { \
+			__VA_ARGS__; \
+			(passes)++; \
+		} while((common_t_ = common_now() - common_start_) < COMMON_MIN_NS); \
+		(elapsed) += common_t_; \
+	} while(0)
+
+static inline uint64_t common_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// 経過時間から1回あたりのナノ秒を出す
+static inline double common_ns_per(uint64_t elapsed_ns, unsigned long long count)
+{
+	return count ? (double)elapsed_ns / count : 0;
+}
+
+// ファイル全体を読んでNUL終端する,読めなければNULL(メッセージを出す)
+static inline char *common_load(const char *path, size_t *len)
+{
+	FILE *fp = fopen(path, "rb");
+	char *buf;
+	long size;
+
+	if(!fp) {
+		fprintf(stderr, "%s: cannot read (run from the top directory)\n", path);
+		return NULL;
+	}
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	rewind(fp);
+	buf = malloc(size + 1);
+	*len = fread(buf, 1, size, fp);
+	buf[*len] = 0;
+	fclose(fp);
+	return buf;
+}
+
+#ifdef COMMON_NANOTODON
+#define main nanotodon_main
+#include "../nanotodon.c"
+#undef main
+
+// パーススレッドが開始時に用意するものを用意する
+// 起動時のタイムライン取得は無いので,ストリーミングの分も溜めずに出すようにしておく
+static inline void common_parse_init(void)
+{
+	nano_queue_init(&ui_queue, UI_QUEUE_SIZE);
+	nano_seen_init(&seen_ids, SEEN_IDS_MAX);
+	nano_intern_init(&stream_names, 16);
+	compile_schemas();
+	released_seq = hold_seq;
+}
+
+// UIキューに出てきたレコードを捨てる,捨てた数を返す
+static inline int common_drain_records(void)
+{
+	struct nano_record *rec;
+	int n = 0;
+
+	while((rec = nano_queue_pop(&ui_queue)) != NULL) {
+		nano_record_free(rec);
+		n++;
+	}
+	return n;
+}
+#endif
+
+#endif
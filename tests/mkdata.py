@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# テストとベンチマークが読むイベントを合成する(実際の受信を記録したものではない)
+# 使い方: python3 tests/mkdata.py (トップのディレクトリで)
+#
+# bench/data/stream.sse  ユーザーストリーム100イベント分(update,notification,delete,status.update,:thump)
+# tests/data/*.json      SSEのupdate,通知,WebSocketのupdate(ブースト),タイムラインの1ページ
+#
+# Mastodonのstatus,account,notificationと同じフィールドを持たせてある(ドメインはexample.social)
+
+import json
+import random
+
+def acct(n):
+	return {"id": "1090%d" % n, "username": "user%d" % n, "acct": "user%d@example.social" % n, "display_name": "ユーザー%d :blobcat:" % n,
+		"locked": False, "bot": False, "discoverable": True, "group": False, "created_at": "2022-11-08T00:00:00.000Z",
+		"note": "<p>自己紹介です \"quoted\" &amp; more</p>", "url": "https://example.social/@user%d" % n, "uri": "https://example.social/users/user%d" % n,
+		"avatar": "https://files.example.social/accounts/avatars/000/000/%03d/original/a.png" % n,
+		"avatar_static": "https://files.example.social/accounts/avatars/000/000/%03d/original/a.png" % n,
+		"header": "https://files.example.social/headers/original/missing.png", "header_static": "https://files.example.social/headers/original/missing.png",
+		"followers_count": 123, "following_count": 45, "statuses_count": 6789, "last_status_at": "2024-05-01",
+		"emojis": [{"shortcode": "blobcat", "url": "https://files.example.social/custom_emojis/images/000/001/original/blobcat.png",
+			"static_url": "https://files.example.social/custom_emojis/images/000/001/static/blobcat.png", "visible_in_picker": True}],
+		"fields": [{"name": "Web", "value": "<a href=\"https://example.org\" rel=\"nofollow noopener\">example.org</a>", "verified_at": None}]}
+
+def status(n, reblog=None):
+	content = "" if reblog else "<p>テスト投稿 %d です。<br />\"引用\" と <a href=\"https://example.org/x?a=1&amp;b=2\">リンク</a> 😀 #タグ</p><p>二段落目 tab\there</p>" % n
+	media = [{"id": "5%d" % n, "type": "image", "url": "https://files.example.social/media_attachments/files/%d/original/img.png" % n,
+		"preview_url": "https://files.example.social/p.png", "remote_url": None, "description": "画像の説明",
+		"blurhash": "UBL_:rOpGG-oBUNG,qRj2so|=eE1w^n4S5NH"}] if n % 2 else []
+	return {"id": "11234567890%04d" % n, "created_at": "2024-05-01T12:%02d:%02d.%03dZ" % (n // 60 % 60, n % 60, n % 1000),
+		"in_reply_to_id": None, "in_reply_to_account_id": None, "sensitive": False, "spoiler_text": "",
+		"visibility": "public" if n % 3 else "unlisted", "language": "ja",
+		"uri": "https://example.social/users/user%d/statuses/%d" % (n, n), "url": "https://example.social/@user%d/%d" % (n, n),
+		"replies_count": n % 5, "reblogs_count": n % 7, "favourites_count": n % 11, "edited_at": None,
+		"favourited": False, "reblogged": False, "muted": False, "bookmarked": False,
+		"content": content, "filtered": [], "reblog": reblog,
+		"application": {"name": "nanotodon", "website": "https://github.com/gomasy/nanotodon"},
+		"account": acct(n), "media_attachments": media,
+		"mentions": [], "tags": [{"name": "タグ", "url": "https://example.social/tags/tag"}], "emojis": [], "card": None, "poll": None}
+
+def dump(o):
+	return json.dumps(o, ensure_ascii=False, separators=(',', ':'))
+
+def write(path, text):
+	with open(path, 'w', encoding='utf-8') as f:
+		f.write(text)
+
+def stream():
+	random.seed(7)
+	out = [": synthetic user stream, generated by tests/mkdata.py (not a capture of a real server)\n\n"]
+	for i in range(100):
+		r = random.random()
+		if i % 8 == 7:
+			out.append(":thump\n\n")
+		if r < 0.65:
+			out.append("event: update\ndata: %s\n\n" % dump(status(1000 + i, reblog=status(5000 + i) if i % 5 == 4 else None)))
+		elif r < 0.8:
+			n = {"id": "%d" % (4000 + i), "type": random.choice(["mention", "favourite", "reblog", "follow"]),
+				"created_at": "2024-05-01T12:00:05.000Z", "account": acct(i), "status": status(2000 + i)}
+			out.append("event: notification\ndata: %s\n\n" % dump(n))
+		elif r < 0.93:
+			out.append("event: delete\ndata: 11234567890%04d\n\n" % (900 + i))
+		else:
+			out.append("event: status.update\ndata: %s\n\n" % dump(status(1000 + i)))
+	write('bench/data/stream.sse', ''.join(out))
+
+def events():
+	write('tests/data/update.json', dump(status(1)))
+	write('tests/data/notification.json', dump({"id": "4001", "type": "mention", "created_at": "2024-05-01T12:00:05.000Z", "account": acct(7), "status": status(2)}))
+	write('tests/data/ws_update.json', dump({"stream": ["user"], "event": "update", "payload": dump(status(3, reblog=status(4)))}))
+	write('tests/data/timeline.json', dump([status(100 - i, reblog=status(200 + i) if i % 4 == 3 else None) for i in range(20)]))
+
+stream()
+events()
@@ -0,0 +1,46 @@
+#ifndef NANOTODON_TESTS_NEON_EMUL_H
+#define NANOTODON_TESTS_NEON_EMUL_H
+
+// sjsonのNEON版の走査が使うintrinsicsをGCCのベクタ拡張で書いたもの(SJSON_NEON_EMULATIONで取り込む)
+// AArch64でなくてもNEON版を動かして確かめられるようにする,読み込みの幅は本物と同じ16バイト
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t uint8x16_t __attribute__((vector_size(16)));
+
+static inline uint8x16_t vdupq_n_u8(uint8_t v)
+{
+	uint8x16_t r;
+	for(int i = 0; i < 16; i++) r[i] = v;
+	return r;
+}
+
+static inline uint8x16_t vld1q_u8(const uint8_t *p)
+{
+	uint8x16_t r;
+	memcpy(&r, p, 16);
+	return r;
+}
+
+// 比べた結果は各バイトが0xFFか0
+static inline uint8x16_t vorrq_u8(uint8x16_t a, uint8x16_t b) { return a | b; }
+static inline uint8x16_t vceqq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a == b); }
+static inline uint8x16_t vcltq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a < b); }
+static inline uint8x16_t vcgeq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a >= b); }
+
+static inline uint8_t vmaxvq_u8(uint8x16_t a)
+{
+	uint8_t m = 0;
+	for(int i = 0; i < 16; i++) if(a[i] > m) m = a[i];
+	return m;
+}
+
+static inline uint8_t vminvq_u8(uint8x16_t a)
+{
+	uint8_t m = 0xFF;
+	for(int i = 0; i < 16; i++) if(a[i] < m) m = a[i];
+	return m;
+}
+
+#endif
@@ -0,0 +1,113 @@
+// パーススレッドが同じ形のイベントを読み続けたとき,sjsonがヒープから確保しないことを確かめる
+// sjsonの確保を数える版に差し替えてsjson.cとnanotodon.cを取り込み,合成したイベント(tests/mkdata.pyで作る)を読ませる
+// (sjson.cを自前で持つので,アーカイブのsjson.oはリンクされない)
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+// 慣らしの後に読む回数
+#define WARMUP_ROUNDS 16
+#define ROUNDS 1000
+
+// arenaに収まらずmallocに回った確保(arenaを使わないコンテキストの分も)
+static unsigned long heap_allocs;
+
+static void *count_malloc(void *user, size_t size)
+{
+	struct nano_arena *a = user;
+	size_t overflow = a ? a->overflow : 0;
+	void *p = a ? nano_arena_alloc(a, size) : malloc(size);
+	if(!a || a->overflow != overflow) heap_allocs++;
+	return p;
+}
+
+static void *count_realloc(void *user, void *ptr, size_t size)
+{
+	struct nano_arena *a = user;
+	size_t overflow = a ? a->overflow : 0;
+	void *p = a ? nano_arena_realloc(a, ptr, size) : realloc(ptr, size);
+	if(!a || a->overflow != overflow) heap_allocs++;
+	return p;
+}
+
+#define sjson_malloc(user, size)		count_malloc((user), (size))
+#define sjson_free(user, ptr)			((user) ? nano_arena_release((user), (ptr)) : free(ptr))
+#define sjson_realloc(user, ptr, size)	count_realloc((user), (ptr), (size))
+
+#include "../sjson.c"
+
+#define COMMON_NANOTODON
+#include "common.h"
+
+// 合成したイベント(tests/dataに置く)
+static const struct {
+	enum raw_event_kind kind;
+	const char *type;
+	const char *path;
+} fixtures[] = {
+	{ RAW_STREAM, "update", "tests/data/update.json" },
+	{ RAW_STREAM, "notification", "tests/data/notification.json" },
+	{ RAW_WS, "", "tests/data/ws_update.json" },
+	{ RAW_TIMELINE, "", "tests/data/timeline.json" },
+};
+
+// イベントをroundsだけ読ませる,パーススレッドと同じく毎回受信バッファの内容を渡す
+static int decode_rounds(int f, const char *json, char *work, size_t len, int rounds)
+{
+	struct raw_event ev;
+	int records = 0;
+
+	for(int i = 0; i < rounds; i++) {
+		memcpy(work, json, len + 1);
+		ev.kind = fixtures[f].kind;
+		snprintf(ev.type, sizeof(ev.type), "%s", fixtures[f].type);
+		ev.data = work;
+		ev.len = len;
+		parse_raw_event(&ev);
+		records += common_drain_records();
+	}
+	return records;
+}
+
+int main(void)
+{
+	int failed = 0;
+
+	common_parse_init();
+	nano_pool_init(&parse_pool, 2);
+
+	for(size_t f = 0; f < sizeof(fixtures) / sizeof(fixtures[0]); f++) {
+		size_t len;
+		char *json = common_load(fixtures[f].path, &len);
+		char *work;
+		unsigned long before;
+
+		if(!json) {
+			failed = 1;
+			continue;
+		}
+		work = malloc(len + 1);
+
+		// 最初の1回でレコードが出ること(読めていなければ確保しないのは当然なので)
+		if(decode_rounds(f, json, work, len, 1) == 0) {
+			printf("FAIL %s: no record\n", fixtures[f].path);
+			failed = 1;
+		}
+		decode_rounds(f, json, work, len, WARMUP_ROUNDS);
+
+		before = heap_allocs;
+		decode_rounds(f, json, work, len, ROUNDS);
+		if(heap_allocs != before) {
+			printf("FAIL %s: %lu heap allocations in %d rounds\n", fixtures[f].path, heap_allocs - before, ROUNDS);
+			failed = 1;
+		} else {
+			printf("ok   %s: 0 heap allocations in %d rounds\n", fixtures[f].path, ROUNDS);
+		}
+
+		free(work);
+		free(json);
+	}
+
+	nano_pool_free(&parse_pool);
+	return failed;
+}
@@ -0,0 +1,108 @@
+// sjsonの文字列と空白の走査(SSE2,AVX2,NEON)が1バイトずつのものと同じ位置で止まることを確かめる
+// NEON版はtests/neon_emul.hでどのcpuでも動かす,文字列を読めないページの直前に置いて読み過ぎないことも確かめる
+#define _DEFAULT_SOURCE		// MAP_ANONYMOUS
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define SJSON_NEON_EMULATION "tests/neon_emul.h"
+#include "../sjson.c"
+#include "common.h"
+
+// AArch64では本物のNEONを使う
+#ifndef SJSON__NEON_EMULATED
+#define SJSON__NEON_EMULATED 0
+#endif
+
+#define ROUNDS 200000
+#define MAX_LEN 80
+
+typedef const char *(*scan_func)(const char *s);
+
+static const struct {
+	const char *name;
+	scan_func string, space;
+} impls[] = {
+#if SJSON__SSE2
+	{ "sse2", sjson__scan_string_sse2, sjson__scan_space_sse2 },
+#endif
+#if SJSON__AVX2
+	{ "avx2", sjson__scan_string_avx2, sjson__scan_space_avx2 },
+#endif
+	{ "neon", sjson__scan_string_neon, sjson__scan_space_neon },
+};
+
+// 文字列に混ぜるもの(走査が止まるものと止まらないものの境目を含める)
+static const char string_bytes[] = "aZ~ \x7f\x1f\x01\"\\\x80\xbf\xe3\xff";
+static const char space_bytes[] = "    \t\n\r\t\n\r a\"\x0b\x80";
+
+static int check_at(char *p, const char *name, scan_func vec, scan_func ref, int round)
+{
+	const char *got = vec(p), *expect = ref(p);
+	CHECK(got == expect, "%s round %d (%zu bytes at page offset %zu): stopped at %td, expected %td", name, round, strlen(p),
+		(size_t)((uintptr_t)p & 4095), got - p, expect - p);
+	return 0;
+}
+
+int main(void)
+{
+	long page = sysconf(_SC_PAGESIZE);
+	char *map, *end;
+	char s[MAX_LEN + 1];
+	uint32_t seed = 1;
+	size_t checked = 0;
+
+#if SJSON__AVX2
+	__builtin_cpu_init();
+	int has_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+	// 2ページ目は読めなくしておき,1ページ目の終わりに文字列を置く
+	map = mmap(NULL, page * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	CHECK(map != MAP_FAILED, "mmap");
+	CHECK(mprotect(map + page, page, PROT_NONE) == 0, "mprotect");
+	end = map + page;
+
+	for(size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+#if SJSON__AVX2
+		if(impls[i].string == sjson__scan_string_avx2 && !has_avx2) {
+			printf("skip avx2: not supported by this cpu\n");
+			continue;
+		}
+#endif
+		for(int round = 0; round < ROUNDS; round++) {
+			int space = round & 1;
+			const char *bytes = space ? space_bytes : string_bytes;
+			size_t nbytes = (space ? sizeof(space_bytes) : sizeof(string_bytes)) - 1;
+			size_t len, align;
+
+			seed = seed * 1103515245 + 12345;
+			len = (seed >> 16) % (MAX_LEN + 1);
+			seed = seed * 1103515245 + 12345;
+			align = (seed >> 16) % 64;
+			for(size_t k = 0; k < len; k++) {
+				seed = seed * 1103515245 + 12345;
+				// 止まる文字は少なめにして長い連続も作る
+				s[k] = bytes[(seed >> 16) % 8 ? (seed >> 24) % 4 : (seed >> 24) % nbytes];
+			}
+			s[len] = 0;
+
+			// ページの先頭近く(揃え方を変えて)と,NULがページの最後のバイトになるところ
+			memcpy(map + align, s, len + 1);
+			memcpy(end - len - 1, s, len + 1);
+			if(space) {
+				if(check_at(map + align, impls[i].name, impls[i].space, sjson__scan_space_c, round)) return 1;
+				if(check_at(end - len - 1, impls[i].name, impls[i].space, sjson__scan_space_c, round)) return 1;
+			} else {
+				if(check_at(map + align, impls[i].name, impls[i].string, sjson__scan_string_c, round)) return 1;
+				if(check_at(end - len - 1, impls[i].name, impls[i].string, sjson__scan_string_c, round)) return 1;
+			}
+			checked += 2;
+		}
+		printf("ok   %s scanners match the byte loop on %d strings, none read past the page%s\n", impls[i].name, ROUNDS,
+			SJSON__NEON_EMULATED && impls[i].string == sjson__scan_string_neon ? " (emulated intrinsics)" : "");
+	}
+
+	munmap(map, page * 2);
+	return checked == 0;
+}
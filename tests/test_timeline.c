@@ -0,0 +1,100 @@
+// 表示済みのタイムライン(timeline.c)に削除と編集が届いたとき,ブーストしたTootにも反映されることを確かめる
+// nanotodon.cを取り込み,ストリーミングのイベントをパースしてapply_recordまで通す(cursesには描かない)
+#include <string.h>
+
+#define COMMON_NANOTODON
+#include "common.h"
+
+#define ACCOUNT "\"account\":{\"acct\":\"user\",\"display_name\":\"User\"}"
+
+// id,本文,ブースト元のJSON(無ければNULL,解放する)からTootのJSONを作る
+static char *status_json(const char *id, const char *content, char *reblog)
+{
+	char *json = malloc(1024);
+	snprintf(json, 1024, "{\"id\":\"%s\",\"created_at\":\"2024-05-01T12:00:00.000Z\",\"content\":\"%s\"," ACCOUNT ",\"reblog\":%s}",
+		id, content, reblog ? reblog : "null");
+	free(reblog);
+	return json;
+}
+
+// ストリーミングのイベントを1つパースさせ,出てきたレコードをUIスレッドと同じように反映する
+static void deliver(const char *type, char *data)
+{
+	struct raw_event ev;
+	struct nano_record *rec;
+
+	ev.kind = RAW_STREAM;
+	snprintf(ev.type, sizeof(ev.type), "%s", type);
+	ev.data = data;
+	ev.len = strlen(data);
+	parse_raw_event(&ev);
+	free(data);
+
+	while((rec = nano_queue_pop(&ui_queue)) != NULL) {
+		if(rec->kind == NANO_RECORD_DELETE || rec->kind == NANO_RECORD_EDIT) {
+			apply_record(rec);
+			nano_record_free(rec);
+		} else {
+			nano_timeline_append(&timeline, rec);
+		}
+	}
+}
+
+// idのTootを含むエントリの数
+static int count_found(const char *id)
+{
+	struct nano_timeline_entry *e = NULL;
+	int n = 0;
+
+	while((e = nano_timeline_find(&timeline, id, e)) != NULL) n++;
+	return n;
+}
+
+// エントリのToot(ブーストならブースト元)の本文
+static const char *shown_content(struct nano_timeline_entry *e)
+{
+	struct nano_status *st = e->rec->status;
+	if(st->reblog) st = st->reblog;
+	return st->content ? st->content->text : "";
+}
+
+int main(void)
+{
+	struct nano_timeline_entry *e;
+
+	common_parse_init();
+	nano_timeline_init(&timeline, 64);
+
+	// 100をブーストした200と201,100そのもの,関係の無い300
+	deliver("update", status_json("200", "", status_json("100", "original", NULL)));
+	deliver("update", status_json("201", "", status_json("100", "original", NULL)));
+	deliver("update", status_json("100", "original", NULL));
+	deliver("update", status_json("300", "other", NULL));
+	CHECK(timeline.count == 4, "%zu entries after 4 updates", timeline.count);
+	CHECK(count_found("100") == 3, "100 found in %d entries, expected 3", count_found("100"));
+	CHECK(count_found("200") == 1 && count_found("201") == 1, "boosts not indexed by their own id");
+	printf("ok   boosts are indexed by their own id and the boosted id\n");
+
+	// 100の編集はブースト2つにも届き,ブーストのIDはそのまま
+	deliver("status.update", status_json("100", "edited", NULL));
+	for(e = nano_timeline_oldest(&timeline); e; e = nano_timeline_next(&timeline, e)) {
+		const char *id = e->rec->status->id;
+		const char *expect = strcmp(id, "300") ? "edited" : "other";
+		CHECK(!strcmp(shown_content(e), expect), "%s shows \"%s\", expected \"%s\"", id, shown_content(e), expect);
+	}
+	e = nano_timeline_find(&timeline, "200", NULL);
+	CHECK(e && e->rec->status->reblog && !strcmp(e->rec->status->reblog->id, "100"), "boost 200 lost its reblog");
+	CHECK(count_found("100") == 3, "100 found in %d entries after the edit, expected 3", count_found("100"));
+	printf("ok   an edit of the boosted toot reaches the boosts\n");
+
+	// 100の削除でブーストも消える
+	deliver("delete", strdup("100"));
+	CHECK(timeline.count == 1, "%zu entries after deleting 100, expected 1", timeline.count);
+	CHECK(count_found("100") == 0 && count_found("200") == 0 && count_found("201") == 0, "deleted entries are still indexed");
+	e = nano_timeline_oldest(&timeline);
+	CHECK(e && !strcmp(e->rec->status->id, "300"), "300 was removed");
+	printf("ok   deleting the boosted toot removes the boosts\n");
+
+	nano_timeline_free(&timeline);
+	return 0;
+}
@@ -0,0 +1,143 @@
+// 文字の表示幅(width.c)を確かめる
+// コードポイントごとの幅はglibcのwcwidthと比べる(わざと違えている範囲は除く),
+// クラスタの幅は例で確かめ,nano_str_widthがnano_cluster_widthの和と同じになることを乱数の並びで確かめる
+#define _XOPEN_SOURCE 700	// wcwidth
+#include <string.h>
+#include <locale.h>
+#include <wchar.h>
+#include "width.h"
+#include "common.h"
+
+// wcwidthと違ってよい範囲
+static const struct {
+	uint32_t lo, hi;
+} wcwidth_differs[] = {
+	{ 0x0000, 0x0000 },		// glibcはNULを0にする
+	{ 0x3248, 0x324F },		// 丸付き数字(EAWはA,glibcは独自に2)
+	{ 0x4DC0, 0x4DFF },		// 易経の卦(EAWはN,glibcは独自に2)
+};
+
+// クラスタの例,幅は端末(絵文字を2桁で描くもの)に合わせる
+static const struct {
+	const char *s;
+	int width;		// 先頭のクラスタの幅
+	int size;		// 先頭のクラスタのバイト数
+	int str_width;		// 文字列全体の幅
+} clusters[] = {
+	{ "a", 1, 1, 1 },
+	{ "ab", 1, 1, 2 },
+	{ "\xc3\xa9", 1, 2, 1 },					// é
+	{ "e\xcc\x81x", 1, 3, 2 },					// e + U+0301
+	{ "\xd0\x96", 1, 2, 1 },					// Ж
+	{ "\xe3\x81\x82", 2, 3, 2 },					// あ
+	{ "\xef\xbc\xa1", 2, 3, 2 },					// 全角A
+	{ "\xe2\x80\x8b", 0, 3, 0 },					// ZWSP
+	{ "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", 2, 9, 2 },		// ハングルの初声+中声+終声
+	{ "\xf0\x9f\x98\x80", 2, 4, 2 },				// 😀
+	{ "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd", 2, 8, 2 },		// 👍 + 肌の色
+	{ "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7", 2, 18, 2 },	// 家族(ZWJ)
+	{ "\xf0\x9f\x87\xaf\xf0\x9f\x87\xb5", 2, 8, 2 },		// 🇯🇵
+	{ "\xf0\x9f\x87\xaf\xf0\x9f\x87\xb5\xf0\x9f\x87\xaf", 2, 8, 3 },	// 🇯🇵 + 対になっていないRI
+	{ "\xe2\x9d\xa4", 1, 3, 1 },					// ❤(テキスト表示)
+	{ "\xe2\x9d\xa4\xef\xb8\x8f", 2, 6, 2 },			// ❤ + VS16
+	{ "\xe2\x98\xba\xef\xb8\x8f!", 2, 6, 3 },			// ☺ + VS16
+	{ "1\xef\xb8\x8f\xe2\x83\xa3", 2, 7, 2 },			// キーキャップ1
+	{ "\xe2\x9d\xa4\xef\xb8\x8e", 1, 6, 1 },			// ❤ + VS15
+	{ "\xf0\x9f\x91\xa8\xe2\x80\x8d\xe2\x9d\xa4\xef\xb8\x8f\xe2\x80\x8d\xf0\x9f\x91\xa8", 2, 20, 2 },	// 👨‍❤️‍👨
+	{ "\xef\xb8\x8f" "a", 0, 3, 1 },				// 前に何も無いVS16
+	{ "\xff" "a", 1, 1, 2 },					// 不正なバイトはU+FFFD
+};
+
+// 乱数で並べる文字(つながり方の違うもの)
+static const uint32_t pieces[] = {
+	'a', ' ', 0xE9, 0x0301, 0x3042, 0x200D, 0xFE0F, 0xFE0E, 0x1F1EF, 0x1F1F5,
+	0x1F3FD, 0x1F468, 0x2764, 0x1100, 0x1161, 0x11A8, 0x200B, 0x20E3,
+};
+
+static int encode(uint32_t cp, char *out)
+{
+	if(cp < 0x80) {
+		out[0] = cp;
+		return 1;
+	} else if(cp < 0x800) {
+		out[0] = 0xc0 | (cp >> 6);
+		out[1] = 0x80 | (cp & 0x3f);
+		return 2;
+	} else if(cp < 0x10000) {
+		out[0] = 0xe0 | (cp >> 12);
+		out[1] = 0x80 | ((cp >> 6) & 0x3f);
+		out[2] = 0x80 | (cp & 0x3f);
+		return 3;
+	}
+	out[0] = 0xf0 | (cp >> 18);
+	out[1] = 0x80 | ((cp >> 12) & 0x3f);
+	out[2] = 0x80 | ((cp >> 6) & 0x3f);
+	out[3] = 0x80 | (cp & 0x3f);
+	return 4;
+}
+
+static int differs_from_wcwidth(uint32_t cp)
+{
+	for(size_t i = 0; i < sizeof(wcwidth_differs) / sizeof(wcwidth_differs[0]); i++) {
+		if(cp >= wcwidth_differs[i].lo && cp <= wcwidth_differs[i].hi) return 1;
+	}
+	return 0;
+}
+
+static int test_wcwidth(void)
+{
+	unsigned long compared = 0;
+
+	if(!setlocale(LC_CTYPE, "C.UTF-8") && !setlocale(LC_CTYPE, "en_US.UTF-8")) {
+		printf("skip wcwidth: no UTF-8 locale\n");
+		return 0;
+	}
+	for(uint32_t cp = 0; cp < 0x110000; cp++) {
+		int expect = wcwidth(cp);
+		// glibcが表示できないとする文字(制御文字,未割り当て)は比べない
+		if(expect < 0 || differs_from_wcwidth(cp)) continue;
+		CHECK(nano_cp_width(cp) == expect, "U+%04X: %d, wcwidth %d (the table may be for another Unicode version, see make width-table)", cp, nano_cp_width(cp), expect);
+		compared++;
+	}
+	printf("ok   nano_cp_width agrees with wcwidth on %lu code points\n", compared);
+	return 0;
+}
+
+static int test_clusters(void)
+{
+	for(size_t i = 0; i < sizeof(clusters) / sizeof(clusters[0]); i++) {
+		int size, width = nano_cluster_width(clusters[i].s, &size);
+		CHECK(width == clusters[i].width && size == clusters[i].size, "cluster %zu: width %d size %d, expected %d %d", i, width, size, clusters[i].width, clusters[i].size);
+		CHECK(nano_str_width(clusters[i].s) == clusters[i].str_width, "string %zu: width %d, expected %d", i, nano_str_width(clusters[i].s), clusters[i].str_width);
+	}
+	printf("ok   %zu cluster cases\n", sizeof(clusters) / sizeof(clusters[0]));
+	return 0;
+}
+
+// 乱数の並びでnano_str_widthとnano_cluster_widthの和を比べる
+static int test_str_width(void)
+{
+	char s[16 * 4 + 1];
+	uint32_t seed = 1;
+
+	for(int round = 0; round < 200000; round++) {
+		int len = 0, n, sum = 0, size;
+
+		seed = seed * 1103515245 + 12345;
+		n = (seed >> 16) % 16;
+		for(int i = 0; i < n; i++) {
+			seed = seed * 1103515245 + 12345;
+			len += encode(pieces[(seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))], s + len);
+		}
+		s[len] = 0;
+		for(const char *p = s; *p; p += size) sum += nano_cluster_width(p, &size);
+		CHECK(nano_str_width(s) == sum, "round %d: nano_str_width %d, clusters %d", round, nano_str_width(s), sum);
+	}
+	printf("ok   nano_str_width matches the cluster sum on 200000 random strings\n");
+	return 0;
+}
+
+int main(void)
+{
+	return test_wcwidth() || test_clusters() || test_str_width();
+}
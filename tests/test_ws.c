@@ -0,0 +1,210 @@
+// WebSocketクライアント(ws.c)を127.0.0.1で待つ小さなサーバにつないで確かめる
+// ハンドシェイク(Sec-WebSocket-Acceptの検証),マスクした送信,断片化したメッセージ,ping/pong,closeを通す
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "ws.h"
+#include "common.h"
+
+enum server_mode {
+	SERVE_OK,		// 正しく応答してフレームをやり取りする
+	SERVE_BAD_ACCEPT,	// 101だがSec-WebSocket-Acceptが違う
+	SERVE_REFUSE,		// 101以外
+};
+
+struct server {
+	int listen_fd;
+	int port;
+	enum server_mode mode;
+
+	// サーバが受け取ったもの(スレッドが終わってから見る)
+	char text[64];		// クライアントから届いたテキスト
+	int got_pong;		// pingと同じ内容のpongが届いた
+	int got_close;		// closeに応答が届いた
+};
+
+static int read_full(int fd, void *buf, size_t n)
+{
+	for(size_t got = 0; got < n; ) {
+		ssize_t r = recv(fd, (char *)buf + got, n - got, 0);
+		if(r <= 0) return 0;
+		got += r;
+	}
+	return 1;
+}
+
+// クライアントからのフレームを1つ読んでマスクを外す,opcodeを返す(失敗は-1)
+static int read_frame(int fd, char *payload, size_t size, size_t *len)
+{
+	unsigned char head[2], mask[4];
+
+	if(!read_full(fd, head, 2) || !(head[1] & 0x80) || (head[1] & 0x7f) >= 126) return -1;
+	*len = head[1] & 0x7f;
+	if(*len >= size || !read_full(fd, mask, 4) || !read_full(fd, payload, *len)) return -1;
+	for(size_t i = 0; i < *len; i++) payload[i] ^= mask[i & 3];
+	payload[*len] = 0;
+	return head[0] & 0x0f;
+}
+
+// サーバから送るフレーム(マスクしない,125バイトまで)をbufに足す
+static size_t put_frame(unsigned char *buf, int fin, int opcode, const char *data, size_t len)
+{
+	buf[0] = (fin ? 0x80 : 0) | opcode;
+	buf[1] = len;
+	memcpy(buf + 2, data, len);
+	return len + 2;
+}
+
+static void *server_main(void *arg)
+{
+	struct server *sv = arg;
+	char req[4096], res[512], key[64] = "", accept_key[32], payload[128];
+	unsigned char out[512];
+	size_t n = 0, len, olen = 0;
+	int fd = accept(sv->listen_fd, NULL, NULL);
+
+	if(fd < 0) return NULL;
+
+	// リクエストヘッダを空行まで読んでキーを拾う
+	while(n < sizeof(req) - 1 && !strstr(req, "\r\n\r\n")) {
+		ssize_t r = recv(fd, req + n, sizeof(req) - 1 - n, 0);
+		if(r <= 0) goto done;
+		n += r;
+		req[n] = 0;
+	}
+	char *k = strstr(req, "Sec-WebSocket-Key: ");
+	if(k) sscanf(k + 19, "%63s", key);
+
+	nano_ws_accept_key(key, accept_key);
+	if(sv->mode == SERVE_BAD_ACCEPT) accept_key[0] = accept_key[0] == 'A' ? 'B' : 'A';
+	if(sv->mode == SERVE_REFUSE) {
+		n = snprintf(res, sizeof(res), "HTTP/1.1 401 Unauthorized\r\nContent-Length: 0\r\n\r\n");
+	} else {
+		n = snprintf(res, sizeof(res), "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nsec-websocket-accept:  %s \r\n\r\n", accept_key);
+	}
+	send(fd, res, n, 0);
+	if(sv->mode != SERVE_OK) goto done;
+
+	// クライアントのテキスト
+	if(read_frame(fd, payload, sizeof(payload), &len) != NANO_WS_TEXT) goto done;
+	snprintf(sv->text, sizeof(sv->text), "%s", payload);
+
+	// 1つ目はそのまま,2つ目は2つに分けて,続けてping
+	olen += put_frame(out + olen, 1, NANO_WS_TEXT, "hello", 5);
+	olen += put_frame(out + olen, 0, NANO_WS_TEXT, "frag", 4);
+	olen += put_frame(out + olen, 1, 0x0, "mented", 6);
+	olen += put_frame(out + olen, 1, 0x9, "p1", 2);
+	send(fd, out, olen, 0);
+	sv->got_pong = read_frame(fd, payload, sizeof(payload), &len) == 0xa && len == 2 && !memcmp(payload, "p1", 2);
+
+	// 1000(正常終了)で閉じる
+	olen = put_frame(out, 1, 0x8, "\x03\xe8", 2);
+	send(fd, out, olen, 0);
+	sv->got_close = read_frame(fd, payload, sizeof(payload), &len) == 0x8;
+
+done:
+	close(fd);
+	return NULL;
+}
+
+static int server_start(struct server *sv, pthread_t *th, enum server_mode mode)
+{
+	struct sockaddr_in addr;
+	socklen_t alen = sizeof(addr);
+
+	memset(sv, 0, sizeof(*sv));
+	sv->mode = mode;
+	sv->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(sv->listen_fd < 0 || bind(sv->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) || listen(sv->listen_fd, 1)) return 0;
+	getsockname(sv->listen_fd, (struct sockaddr *)&addr, &alen);
+	sv->port = ntohs(addr.sin_port);
+	return pthread_create(th, NULL, server_main, sv) == 0;
+}
+
+// 受け取ったメッセージを順に並べる
+struct received {
+	char text[128];
+	int count;
+};
+
+static void on_message(int opcode, char *data, size_t len, void *user)
+{
+	struct received *r = user;
+	size_t n = strlen(r->text);
+	snprintf(r->text + n, sizeof(r->text) - n, "%s%d:%.*s", n ? "," : "", opcode, (int)len, data);
+	r->count++;
+}
+
+// modeのサーバにつなぐ,nano_ws_connectの戻り値を返す
+static int connect_to(struct server *sv, pthread_t *th, enum server_mode mode, CURL **hnd, struct nano_ws *ws, char *errbuf)
+{
+	char url[64];
+
+	if(!server_start(sv, th, mode)) return -2;
+	snprintf(url, sizeof(url), "http://127.0.0.1:%d/", sv->port);
+	*hnd = curl_easy_init();
+	curl_easy_setopt(*hnd, CURLOPT_URL, url);
+	errbuf[0] = 0;
+	return nano_ws_connect(ws, *hnd, "127.0.0.1", "api/v1/streaming", NULL, errbuf, CURL_ERROR_SIZE);
+}
+
+static void disconnect(struct server *sv, pthread_t th, CURL *hnd, struct nano_ws *ws)
+{
+	nano_ws_free(ws);
+	curl_easy_cleanup(hnd);
+	pthread_join(th, NULL);
+	close(sv->listen_fd);
+}
+
+int main(void)
+{
+	struct server sv;
+	struct received r;
+	struct nano_ws ws;
+	pthread_t th;
+	CURL *hnd;
+	char accept[32], errbuf[CURL_ERROR_SIZE];
+	int ret;
+
+	curl_global_init(CURL_GLOBAL_DEFAULT);
+
+	// RFC 6455の例
+	nano_ws_accept_key("dGhlIHNhbXBsZSBub25jZQ==", accept);
+	CHECK(!strcmp(accept, "s3pPLMBiTxaQ9kYGzzhZRbK+xOo="), "accept key: %s", accept);
+	printf("ok   accept key\n");
+
+	// 正しいサーバとはメッセージをやり取りして,closeで0が返る
+	ret = connect_to(&sv, &th, SERVE_OK, &hnd, &ws, errbuf);
+	CHECK(ret == 0, "handshake: %d %s", ret, errbuf);
+	CHECK(nano_ws_send_text(&ws, "subscribe", 9), "send");
+	memset(&r, 0, sizeof(r));
+	ret = nano_ws_run(&ws, on_message, &r, 5, errbuf, sizeof(errbuf));
+	disconnect(&sv, th, hnd, &ws);
+	CHECK(ret == 0, "run: %d %s", ret, errbuf);
+	CHECK(!strcmp(sv.text, "subscribe"), "server got \"%s\"", sv.text);
+	CHECK(!strcmp(r.text, "1:hello,1:fragmented"), "client got \"%s\"", r.text);
+	CHECK(sv.got_pong, "no pong");
+	CHECK(sv.got_close, "no close reply");
+	printf("ok   handshake, send, fragments, ping, close\n");
+
+	// Sec-WebSocket-Acceptが違えば失敗
+	ret = connect_to(&sv, &th, SERVE_BAD_ACCEPT, &hnd, &ws, errbuf);
+	disconnect(&sv, th, hnd, &ws);
+	CHECK(ret == -1 && strstr(errbuf, "Sec-WebSocket-Accept"), "bad accept: %d %s", ret, errbuf);
+	printf("ok   bad Sec-WebSocket-Accept rejected\n");
+
+	// 101以外は失敗
+	ret = connect_to(&sv, &th, SERVE_REFUSE, &hnd, &ws, errbuf);
+	disconnect(&sv, th, hnd, &ws);
+	CHECK(ret == -1 && strstr(errbuf, "401"), "refused: %d %s", ret, errbuf);
+	printf("ok   refused upgrade rejected\n");
+
+	curl_global_cleanup();
+	return 0;
+}
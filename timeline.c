@@ -0,0 +1,247 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "timeline.h"
+
+uint64_t nano_status_key(const char *id)
+{
+	uint64_t key = 0;
+	const char *p;
+	
+	if(!id || !*id) return 0;
+	
+	// MastodonのIDは数字,そうでない実装(Pleromaなど)はFNV-1aで
+	for(p = id; *p >= '0' && *p <= '9'; p++) key = key * 10 + (*p - '0');
+	if(*p == 0) return key;
+	
+	key = 14695981039346656037ULL;
+	for(p = id; *p; p++) {
+		key ^= (unsigned char)*p;
+		key *= 1099511628211ULL;
+	}
+	return key;
+}
+
+// レコードが指すTootの置き場所(通知なら対象のToot),無ければNULL
+static struct nano_status **record_status(const struct nano_record *rec)
+{
+	switch(rec->kind) {
+	case NANO_RECORD_STATUS:
+		return rec->status ? (struct nano_status **)&rec->status : NULL;
+	case NANO_RECORD_NOTIFICATION:
+		return rec->notify && rec->notify->status ? &rec->notify->status : NULL;
+	default:
+		return NULL;
+	}
+}
+
+const char *nano_record_status_id(const struct nano_record *rec)
+{
+	struct nano_status **st = record_status(rec);
+	return st ? (*st)->id : NULL;
+}
+
+const char *nano_record_reblog_id(const struct nano_record *rec)
+{
+	struct nano_status **st = record_status(rec);
+	return st && (*st)->reblog ? (*st)->reblog->id : NULL;
+}
+
+// 索引の鎖iのID
+static const char *link_id(const struct nano_timeline_entry *e, int i)
+{
+	return i == 0 ? nano_record_status_id(e->rec) : nano_record_reblog_id(e->rec);
+}
+
+static size_t bucket_of(const struct nano_timeline *tl, uint64_t key)
+{
+	// 連番に近いIDでも散らばるように
+	return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & tl->mask;
+}
+
+int nano_timeline_init(struct nano_timeline *tl, size_t max)
+{
+	size_t n = 16;
+	while(n < max) n <<= 1;
+	
+	memset(tl, 0, sizeof(*tl));
+	tl->ring = calloc(n, sizeof(struct nano_timeline_entry));
+	tl->buckets = calloc(n, sizeof(struct nano_timeline_entry *));
+	if(!tl->ring || !tl->buckets) {
+		free(tl->ring);
+		free(tl->buckets);
+		return 0;
+	}
+	tl->ring_mask = n - 1;
+	tl->mask = n - 1;
+	return 1;
+}
+
+void nano_timeline_free(struct nano_timeline *tl)
+{
+	for(size_t i = tl->head; i != tl->tail; i++) {
+		struct nano_timeline_entry *e = &tl->ring[i & tl->ring_mask];
+		if(e->rec) nano_timeline_remove(tl, e);
+	}
+	for(size_t i = 0; i <= tl->ring_mask; i++) nano_layout_free(&tl->ring[i].layout);
+	free(tl->ring);
+	free(tl->buckets);
+	tl->ring = NULL;
+	tl->buckets = NULL;
+}
+
+static void unindex(struct nano_timeline *tl, struct nano_timeline_entry *e)
+{
+	for(int i = 0; i < 2; i++) {
+		struct nano_timeline_link *l = &e->link[i], **pp;
+		
+		if(!l->entry) continue;
+		for(pp = &tl->buckets[bucket_of(tl, l->key)]; *pp; pp = &(*pp)->next) {
+			if(*pp == l) {
+				*pp = l->next;
+				break;
+			}
+		}
+		l->next = NULL;
+		l->entry = NULL;
+	}
+}
+
+static void index_entry(struct nano_timeline *tl, struct nano_timeline_entry *e)
+{
+	for(int i = 0; i < 2; i++) {
+		struct nano_timeline_link *l = &e->link[i];
+		const char *id = link_id(e, i);
+		
+		l->next = NULL;
+		l->entry = NULL;
+		if(!id) continue;
+		l->key = nano_status_key(id);
+		l->entry = e;
+		size_t b = bucket_of(tl, l->key);
+		l->next = tl->buckets[b];
+		tl->buckets[b] = l;
+	}
+}
+
+void nano_timeline_append(struct nano_timeline *tl, struct nano_record *rec)
+{
+	struct nano_timeline_entry *e;
+	
+	// いっぱいなら最も古い枠を空ける
+	if(tl->tail - tl->head > tl->ring_mask) {
+		e = &tl->ring[tl->head & tl->ring_mask];
+		if(e->rec) nano_timeline_remove(tl, e);
+		tl->head++;
+	}
+	
+	e = &tl->ring[tl->tail++ & tl->ring_mask];
+	e->rec = rec;
+	tl->count++;
+	index_entry(tl, e);
+}
+
+// eの通し番号(head基準の位置)
+static size_t position(const struct nano_timeline *tl, const struct nano_timeline_entry *e)
+{
+	return ((size_t)(e - tl->ring) - tl->head) & tl->ring_mask;
+}
+
+struct nano_timeline_entry *nano_timeline_oldest(struct nano_timeline *tl)
+{
+	return nano_timeline_seek(tl, tl->head);
+}
+
+struct nano_timeline_entry *nano_timeline_newest(struct nano_timeline *tl)
+{
+	for(size_t i = tl->tail; i != tl->head; i--) {
+		struct nano_timeline_entry *e = &tl->ring[(i - 1) & tl->ring_mask];
+		if(e->rec) return e;
+	}
+	return NULL;
+}
+
+struct nano_timeline_entry *nano_timeline_prev(struct nano_timeline *tl, struct nano_timeline_entry *e)
+{
+	for(size_t i = tl->head + position(tl, e); i != tl->head; i--) {
+		struct nano_timeline_entry *p = &tl->ring[(i - 1) & tl->ring_mask];
+		if(p->rec) return p;
+	}
+	return NULL;
+}
+
+struct nano_timeline_entry *nano_timeline_next(struct nano_timeline *tl, struct nano_timeline_entry *e)
+{
+	for(size_t i = tl->head + position(tl, e) + 1; i != tl->tail; i++) {
+		struct nano_timeline_entry *n = &tl->ring[i & tl->ring_mask];
+		if(n->rec) return n;
+	}
+	return NULL;
+}
+
+size_t nano_timeline_serial(const struct nano_timeline *tl, const struct nano_timeline_entry *e)
+{
+	return tl->head + position(tl, e);
+}
+
+struct nano_timeline_entry *nano_timeline_seek(struct nano_timeline *tl, size_t serial)
+{
+	// headより前は捨てた分
+	if((ptrdiff_t)(serial - tl->head) < 0) serial = tl->head;
+	if((ptrdiff_t)(tl->tail - serial) < 0) return NULL;
+	for(; serial != tl->tail; serial++) {
+		struct nano_timeline_entry *e = &tl->ring[serial & tl->ring_mask];
+		if(e->rec) return e;
+	}
+	return NULL;
+}
+
+// lがidの鎖か(文字列IDのハッシュは衝突しうるので最後に文字列で確かめる)
+static int link_matches(const struct nano_timeline_link *l, uint64_t key, const char *id)
+{
+	const char *lid;
+	
+	if(!l->entry || l->key != key) return 0;
+	lid = link_id(l->entry, l == &l->entry->link[1]);
+	return lid && !strcmp(lid, id);
+}
+
+struct nano_timeline_entry *nano_timeline_find(struct nano_timeline *tl, const char *id, struct nano_timeline_entry *after)
+{
+	uint64_t key = nano_status_key(id);
+	struct nano_timeline_link *l = tl->buckets[bucket_of(tl, key)];
+	
+	// afterがどちらのIDで一致したかで続きの位置が決まる
+	if(after) l = (link_matches(&after->link[1], key, id) ? &after->link[1] : &after->link[0])->next;
+	
+	for(; l; l = l->next) {
+		if(link_matches(l, key, id)) return l->entry;
+	}
+	return NULL;
+}
+
+void nano_timeline_remove(struct nano_timeline *tl, struct nano_timeline_entry *e)
+{
+	// 枠は空きとして残し,リングが一周したときに再利用する(レイアウトの領域も使い回す)
+	unindex(tl, e);
+	tl->count--;
+	nano_record_free(e->rec);
+	e->rec = NULL;
+	nano_layout_clear(&e->layout);
+}
+
+void nano_timeline_replace(struct nano_timeline *tl, struct nano_timeline_entry *e, struct nano_status *st)
+{
+	struct nano_status **slot = record_status(e->rec);
+	
+	(void)tl;
+	// 同じIDなので索引は付け直さなくてよい,表示内容は作り直す
+	nano_layout_clear(&e->layout);
+	if(!slot) {
+		nano_status_free(st);
+		return;
+	}
+	if(strcmp((*slot)->id, st->id) && (*slot)->reblog && !strcmp((*slot)->reblog->id, st->id)) slot = &(*slot)->reblog;
+	nano_status_free(*slot);
+	*slot = st;
+}
@@ -0,0 +1,75 @@
+#ifndef NANOTODON_TIMELINE_H
+#define NANOTODON_TIMELINE_H
+
+#include <stdint.h>
+#include "status.h"
+#include "layout.h"
+
+struct nano_timeline_entry;
+
+// 索引の鎖の1つ
+struct nano_timeline_link {
+	uint64_t key;				// Toot IDの数値(索引のキー)
+	struct nano_timeline_link *next;	// 同じバケットの次
+	struct nano_timeline_entry *entry;	// 索引に入っていなければNULL
+};
+
+// 表示済みのレコード1件(リングの1枠)
+struct nano_timeline_entry {
+	struct nano_record *rec;		// NULLなら削除済みの空き枠
+	struct nano_timeline_link link[2];	// TootのIDとブースト元のID(ブーストでなければ[1]は使わない)
+	struct nano_layout layout;		// 表示内容(描くときに作り,差し替えたら消す)
+};
+
+// 表示済みのレコードを古い順にリングで保持し,Toot ID(ブーストならブースト元のIDでも)で引けるようにする
+// 画面の描き直しはここからだけで行い,ネットワークには取りに行かない
+struct nano_timeline {
+	struct nano_timeline_entry *ring;
+	size_t ring_mask;			// リングの大きさ-1(2の冪,これを超えたら古いものから捨てる)
+	size_t head;				// 最も古い枠の通し番号
+	size_t tail;				// 次に追加する枠の通し番号
+	size_t count;				// 削除済みを除いた件数
+
+	struct nano_timeline_link **buckets;
+	size_t mask;				// バケット数-1(2の冪)
+};
+
+// Toot IDを索引のキーにする(数字でなければ文字列のハッシュ)
+uint64_t nano_status_key(const char *id);
+
+// レコードが指すTootのID(通知なら対象のToot),無ければNULL
+const char *nano_record_status_id(const struct nano_record *rec);
+
+// レコードが指すTootがブーストならブースト元のID,でなければNULL
+const char *nano_record_reblog_id(const struct nano_record *rec);
+
+// maxは2の冪に切り上げる
+int nano_timeline_init(struct nano_timeline *tl, size_t max);
+void nano_timeline_free(struct nano_timeline *tl);
+
+// レコードの所有権を移して末尾に追加する
+void nano_timeline_append(struct nano_timeline *tl, struct nano_record *rec);
+
+// 最も古い/新しいエントリと,eの1つ古い/新しいエントリ(削除済みは飛ばす,無ければNULL)
+struct nano_timeline_entry *nano_timeline_oldest(struct nano_timeline *tl);
+struct nano_timeline_entry *nano_timeline_newest(struct nano_timeline *tl);
+struct nano_timeline_entry *nano_timeline_prev(struct nano_timeline *tl, struct nano_timeline_entry *e);
+struct nano_timeline_entry *nano_timeline_next(struct nano_timeline *tl, struct nano_timeline_entry *e);
+
+// エントリの通し番号(追加した順,リングが一周しても増え続ける)
+size_t nano_timeline_serial(const struct nano_timeline *tl, const struct nano_timeline_entry *e);
+
+// 通し番号serial以降で最初のエントリ(既に捨てていれば最も古いもの,無ければNULL)
+struct nano_timeline_entry *nano_timeline_seek(struct nano_timeline *tl, size_t serial);
+
+// idのTootを含むエントリ(ブースト元がidのものも)を探す,afterを渡すとその次の一致から探す
+struct nano_timeline_entry *nano_timeline_find(struct nano_timeline *tl, const char *id, struct nano_timeline_entry *after);
+
+// エントリを取り除いてレコードを解放する
+void nano_timeline_remove(struct nano_timeline *tl, struct nano_timeline_entry *e);
+
+// エントリのTootを差し替える(古いTootは解放する)
+// stのIDがブースト元のものなら,ブーストはそのままでブースト元だけを差し替える
+void nano_timeline_replace(struct nano_timeline *tl, struct nano_timeline_entry *e, struct nano_status *st);
+
+#endif
@@ -0,0 +1,164 @@
+#include "width.h"
+#include "width_table.h"
+
+#define ZWJ 0x200D
+#define VS16 0xFE0F	// 絵文字として表示する異体字セレクタ
+
+uint32_t nano_utf8_decode(const char *s, int *size)
+{
+	const uint8_t *p = (const uint8_t *)s;
+	uint32_t cp, min;
+	int n;
+
+	if(p[0] < 0x80) {
+		*size = 1;
+		return p[0];
+	} else if(p[0] >= 0xc2 && p[0] <= 0xdf) {
+		n = 2;
+		cp = p[0] & 0x1f;
+		min = 0x80;
+	} else if((p[0] & 0xf0) == 0xe0) {
+		n = 3;
+		cp = p[0] & 0x0f;
+		min = 0x800;
+	} else if(p[0] >= 0xf0 && p[0] <= 0xf4) {
+		n = 4;
+		cp = p[0] & 0x07;
+		min = 0x10000;
+	} else {
+		*size = 1;
+		return 0xFFFD;
+	}
+
+	for(int i = 1; i < n; i++) {
+		// 終端か途中で切れている
+		if((p[i] & 0xc0) != 0x80) {
+			*size = 1;
+			return 0xFFFD;
+		}
+		cp = (cp << 6) | (p[i] & 0x3f);
+	}
+	// 冗長な表現,サロゲート,範囲外
+	if(cp < min || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+		*size = 1;
+		return 0xFFFD;
+	}
+	*size = n;
+	return cp;
+}
+
+int nano_cp_width(uint32_t cp)
+{
+	// ASCIIも表にあるので分岐はこれだけ
+	if(cp >= 0x110000) return 1;
+	return (width_stage2[width_stage1[cp >> 8]][(cp & 0xff) >> 2] >> ((cp & 3) * 2)) & 3;
+}
+
+static int is_regional_indicator(uint32_t cp)
+{
+	return cp >= 0x1F1E6 && cp <= 0x1F1FF;
+}
+
+static int is_emoji_modifier(uint32_t cp)
+{
+	return cp >= 0x1F3FB && cp <= 0x1F3FF;
+}
+
+int nano_cluster_width(const char *s, int *size)
+{
+	uint32_t base, cp;
+	int n, len, width;
+
+	// ASCIIは後ろに結合文字が続かなければそれだけで1つ
+	if((uint8_t)s[0] < 0x80 && (uint8_t)s[1] < 0xcc) {
+		*size = 1;
+		return 1;
+	}
+
+	base = nano_utf8_decode(s, &len);
+	width = nano_cp_width(base);
+
+	// 国旗は2つで1つ
+	if(is_regional_indicator(base)) {
+		cp = nano_utf8_decode(s + len, &n);
+		if(is_regional_indicator(cp)) {
+			*size = len + n;
+			return 2;
+		}
+	}
+
+	// 前とつながる文字はどれもU+0300以降なので,先頭バイトが0xcc未満なら読まずに終わる
+	while((uint8_t)s[len] >= 0xcc) {
+		cp = nano_utf8_decode(s + len, &n);
+		if(cp == ZWJ) {
+			// ZWJの次の文字は前とつながって描かれる
+			int m;
+			len += n;
+			if(!s[len]) break;
+			nano_utf8_decode(s + len, &m);
+			len += m;
+		} else if(nano_cp_width(cp) == 0 || is_emoji_modifier(cp)) {
+			// VS16が付くと絵文字で描かれるので幅2(U+2764 U+FE0Fなど)
+			if(cp == VS16) width = 2;
+			len += n;
+		} else {
+			break;
+		}
+	}
+
+	*size = len;
+	return width;
+}
+
+// nano_cluster_widthを足し合わせたのと同じ結果を,1文字ずつ1回だけ読んで求める
+int nano_str_width(const char *s)
+{
+	int width = 0, size;
+	int open = 0;		// 後ろに文字をつなげられるクラスタがある
+	int joined = 0;		// 直前がつながっているZWJ
+	int ri = 0;		// 開いているクラスタがRegional Indicator1つだけ
+	int cluster = 0;	// 開いているクラスタの幅
+	uint32_t cp;
+
+	while(*s) {
+		// ASCIIはZWJの後でなければ必ず新しいクラスタ
+		if((uint8_t)*s < 0x80 && !joined) {
+			width++;
+			s++;
+			open = 1;
+			ri = 0;
+			cluster = 1;
+			continue;
+		}
+
+		cp = nano_utf8_decode(s, &size);
+		s += size;
+		int w = nano_cp_width(cp);
+
+		if(joined) {
+			joined = 0;
+			ri = 0;
+		} else if(open && ri && is_regional_indicator(cp)) {
+			// 国旗の対はそこで閉じる
+			width += 2 - w;
+			open = ri = 0;
+			cluster = 2;
+		} else if(open && cp == ZWJ) {
+			joined = 1;
+			ri = 0;
+		} else if(open && (w == 0 || is_emoji_modifier(cp))) {
+			ri = 0;
+			if(cp == VS16 && cluster < 2) {
+				width += 2 - cluster;
+				cluster = 2;
+			}
+		} else {
+			// 新しいクラスタ
+			width += w;
+			open = 1;
+			ri = is_regional_indicator(cp);
+			cluster = w;
+		}
+	}
+	return width;
+}
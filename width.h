@@ -0,0 +1,24 @@
+#ifndef NANOTODON_WIDTH_H
+#define NANOTODON_WIDTH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// UTF-8を1文字読んでコードポイントを返す,sizeにバイト数を返す
+// 不正な並びは1バイトをU+FFFDとして読む(終端は越えない)
+uint32_t nano_utf8_decode(const char *s, int *size);
+
+// コードポイントの表示幅(0, 1, 2)
+// East Asian WidthのWとFは2,結合文字や書式文字は0,曖昧幅(A)は1
+int nano_cp_width(uint32_t cp);
+
+// 書記素クラスタ1つ分の表示幅,sizeにバイト数を返す
+// 幅0の文字(結合文字,異体字セレクタ),ZWJでつないだ絵文字,肌の色の修飾子,
+// 国旗(Regional Indicatorの対)は前の文字と合わせて1つに数える
+// VS16(U+FE0F)が付いたクラスタは絵文字として描かれるので幅2
+int nano_cluster_width(const char *s, int *size);
+
+// 文字列の表示幅
+int nano_str_width(const char *s);
+
+#endif
@@ -0,0 +1,410 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <poll.h>
+#include <time.h>
+#include "ws.h"
+
+#define WS_OP_CONT 0x0
+#define WS_OP_CLOSE 0x8
+#define WS_OP_PING 0x9
+#define WS_OP_PONG 0xa
+
+// 1メッセージの上限,これを超えるものは壊れているとみなす
+#define WS_MAX_MESSAGE (16 * 1024 * 1024)
+
+// Sec-WebSocket-Acceptを作るときにキーの後ろに付ける(RFC 6455)
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+static int ws_reserve(char **buf, size_t *cap, size_t need);
+static int ws_wait(struct nano_ws *ws, short events, int timeout_ms);
+static int ws_send_all(struct nano_ws *ws, const char *data, size_t len);
+static int ws_send_frame(struct nano_ws *ws, int opcode, const char *data, size_t len);
+static void ws_base64(const unsigned char *src, size_t n, char *dst);
+static void ws_sha1(const unsigned char *src, size_t n, unsigned char digest[20]);
+
+static int ws_reserve(char **buf, size_t *cap, size_t need)
+{
+	if(need <= *cap) return 1;
+	size_t c = *cap ? *cap : 4096;
+	while(c < need) c *= 2;
+	char *p = realloc(*buf, c);
+	if(!p) return 0;
+	*buf = p;
+	*cap = c;
+	return 1;
+}
+
+// ソケットが読み書きできるまで待つ,タイムアウトなら0
+static int ws_wait(struct nano_ws *ws, short events, int timeout_ms)
+{
+	struct pollfd pfd;
+	pfd.fd = ws->sock;
+	pfd.events = events;
+	return poll(&pfd, 1, timeout_ms);
+}
+
+static int ws_send_all(struct nano_ws *ws, const char *data, size_t len)
+{
+	while(len > 0) {
+		size_t sent = 0;
+		CURLcode ret = curl_easy_send(ws->hnd, data, len, &sent);
+		if(ret == CURLE_AGAIN) {
+			if(ws_wait(ws, POLLOUT, 10000) <= 0) return 0;
+			continue;
+		}
+		if(ret != CURLE_OK) return 0;
+		data += sent;
+		len -= sent;
+	}
+	return 1;
+}
+
+// クライアントから送るフレームは必ずマスクする
+static int ws_send_frame(struct nano_ws *ws, int opcode, const char *data, size_t len)
+{
+	unsigned char head[14];
+	size_t hlen = 0;
+	unsigned char mask[4];
+	int ok;
+
+	head[hlen++] = 0x80 | opcode;
+	if(len < 126) {
+		head[hlen++] = 0x80 | len;
+	} else if(len < 65536) {
+		head[hlen++] = 0x80 | 126;
+		head[hlen++] = len >> 8;
+		head[hlen++] = len;
+	} else {
+		head[hlen++] = 0x80 | 127;
+		for(int i = 7; i >= 0; i--) head[hlen++] = (uint64_t)len >> (i * 8);
+	}
+	for(int i = 0; i < 4; i++) head[hlen++] = mask[i] = rand();
+
+	char *masked = malloc(len ? len : 1);
+	if(!masked) return 0;
+	for(size_t i = 0; i < len; i++) masked[i] = data[i] ^ mask[i & 3];
+
+	ok = ws_send_all(ws, (char *)head, hlen) && ws_send_all(ws, masked, len);
+	free(masked);
+	return ok;
+}
+
+int nano_ws_send_text(struct nano_ws *ws, const char *data, size_t len)
+{
+	return ws_send_frame(ws, NANO_WS_TEXT, data, len);
+}
+
+static void ws_base64(const unsigned char *src, size_t n, char *dst)
+{
+	static const char tbl[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	size_t i;
+	for(i = 0; i + 2 < n; i += 3) {
+		*dst++ = tbl[src[i] >> 2];
+		*dst++ = tbl[((src[i] & 3) << 4) | (src[i + 1] >> 4)];
+		*dst++ = tbl[((src[i + 1] & 15) << 2) | (src[i + 2] >> 6)];
+		*dst++ = tbl[src[i + 2] & 63];
+	}
+	if(i < n) {
+		*dst++ = tbl[src[i] >> 2];
+		if(i + 1 < n) {
+			*dst++ = tbl[((src[i] & 3) << 4) | (src[i + 1] >> 4)];
+			*dst++ = tbl[(src[i + 1] & 15) << 2];
+		} else {
+			*dst++ = tbl[(src[i] & 3) << 4];
+			*dst++ = '=';
+		}
+		*dst++ = '=';
+	}
+	*dst = 0;
+}
+
+#define ws_rol(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+// Sec-WebSocket-Acceptの検証にだけ使う
+static void ws_sha1(const unsigned char *src, size_t n, unsigned char digest[20])
+{
+	uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+	unsigned char block[64];
+	uint64_t bits = (uint64_t)n * 8;
+	size_t total = (n + 8) / 64 * 64 + 64;	// 0x80と長さを足して64バイト単位に
+
+	for(size_t off = 0; off < total; off += 64) {
+		uint32_t w[80], a, b, c, d, e;
+		for(size_t i = 0; i < 64; i++) {
+			size_t k = off + i;
+			if(k < n) block[i] = src[k];
+			else if(k == n) block[i] = 0x80;
+			else if(k >= total - 8) block[i] = bits >> ((total - 1 - k) * 8);
+			else block[i] = 0;
+		}
+		for(int i = 0; i < 16; i++) w[i] = (uint32_t)block[i * 4] << 24 | block[i * 4 + 1] << 16 | block[i * 4 + 2] << 8 | block[i * 4 + 3];
+		for(int i = 16; i < 80; i++) w[i] = ws_rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+		a = h[0]; b = h[1]; c = h[2]; d = h[3]; e = h[4];
+		for(int i = 0; i < 80; i++) {
+			uint32_t f, k;
+			if(i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+			else if(i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+			else if(i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+			else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+			uint32_t t = ws_rol(a, 5) + f + e + k + w[i];
+			e = d; d = c; c = ws_rol(b, 30); b = a; a = t;
+		}
+		h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+	}
+	for(int i = 0; i < 20; i++) digest[i] = h[i / 4] >> ((3 - i % 4) * 8);
+}
+
+void nano_ws_accept_key(const char *key, char *accept)
+{
+	char buf[128];
+	unsigned char digest[20];
+	size_t n = (size_t)snprintf(buf, sizeof(buf), "%s" WS_GUID, key);
+	ws_sha1((unsigned char *)buf, n < sizeof(buf) ? n : sizeof(buf) - 1, digest);
+	ws_base64(digest, sizeof(digest), accept);
+}
+
+// レスポンスヘッダ[head, end)からnameの値を探す(前後の空白は除く),無ければNULL
+static const char *ws_header(const char *head, const char *end, const char *name, size_t *len)
+{
+	size_t nlen = strlen(name);
+	const char *p = strstr(head, "\r\n");
+
+	while(p && p < end) {
+		p += 2;
+		if(!strncasecmp(p, name, nlen) && p[nlen] == ':') {
+			const char *v = p + nlen + 1, *e = strstr(v, "\r\n");
+			while(*v == ' ' || *v == '\t') v++;
+			while(e > v && (e[-1] == ' ' || e[-1] == '\t')) e--;
+			*len = e - v;
+			return v;
+		}
+		p = strstr(p, "\r\n");
+	}
+	return NULL;
+}
+
+int nano_ws_connect(struct nano_ws *ws, CURL *hnd, const char *host, const char *path, struct curl_slist *headers, char *errbuf, size_t errlen)
+{
+	CURLcode ret;
+	unsigned char nonce[16];
+	char key[32];
+
+	memset(ws, 0, sizeof(*ws));
+	ws->hnd = hnd;
+
+	// TLS接続まではlibcurlに任せる
+	curl_easy_setopt(hnd, CURLOPT_CONNECT_ONLY, 1L);
+	ret = curl_easy_perform(hnd);
+	if(ret != CURLE_OK) {
+		if(!errbuf[0]) snprintf(errbuf, errlen, "%s", curl_easy_strerror(ret));
+		return -1;
+	}
+	curl_easy_getinfo(hnd, CURLINFO_ACTIVESOCKET, &ws->sock);
+
+	// Upgradeリクエスト
+	for(int i = 0; i < 16; i++) nonce[i] = rand();
+	ws_base64(nonce, sizeof(nonce), key);
+
+	size_t reqlen = strlen(path) + strlen(host) + 256;
+	for(struct curl_slist *h = headers; h; h = h->next) reqlen += strlen(h->data) + 2;
+	char *req = malloc(reqlen);
+	int n = snprintf(req, reqlen,
+		"GET /%s HTTP/1.1\r\n"
+		"Host: %s\r\n"
+		"Upgrade: websocket\r\n"
+		"Connection: Upgrade\r\n"
+		"Sec-WebSocket-Key: %s\r\n"
+		"Sec-WebSocket-Version: 13\r\n", path, host, key);
+	for(struct curl_slist *h = headers; h; h = h->next) n += snprintf(req + n, reqlen - n, "%s\r\n", h->data);
+	n += snprintf(req + n, reqlen - n, "\r\n");
+
+	int ok = ws_send_all(ws, req, n);
+	free(req);
+	if(!ok) {
+		snprintf(errbuf, errlen, "WebSocket handshake send failed");
+		return -1;
+	}
+
+	// レスポンスヘッダを空行まで読む(後ろにフレームが続いていればそのまま受信バッファに残す)
+	char *end = NULL;
+	while(!end) {
+		size_t got = 0;
+		if(!ws_reserve(&ws->buf, &ws->cap, ws->len + 4096 + 1)) return -1;
+		ret = curl_easy_recv(hnd, ws->buf + ws->len, ws->cap - ws->len - 1, &got);
+		if(ret == CURLE_AGAIN) {
+			if(ws_wait(ws, POLLIN, 30000) <= 0) {
+				snprintf(errbuf, errlen, "WebSocket handshake timed out");
+				return -1;
+			}
+			continue;
+		}
+		if(ret != CURLE_OK || got == 0) {
+			snprintf(errbuf, errlen, "WebSocket handshake failed (%s)", ret != CURLE_OK ? curl_easy_strerror(ret) : "connection closed");
+			return -1;
+		}
+		ws->len += got;
+		ws->buf[ws->len] = 0;
+		end = strstr(ws->buf, "\r\n\r\n");
+	}
+
+	int status = 0;
+	if(sscanf(ws->buf, "HTTP/%*s %d", &status) != 1 || status != 101) {
+		snprintf(errbuf, errlen, "WebSocket upgrade refused (HTTP %d)", status);
+		return -1;
+	}
+
+	// 送ったキーに対する応答であること(途中のプロキシなどが勝手に返したものでないこと)
+	char accept[32];
+	size_t alen;
+	const char *got = ws_header(ws->buf, end, "Sec-WebSocket-Accept", &alen);
+	nano_ws_accept_key(key, accept);
+	if(!got || alen != strlen(accept) || memcmp(got, accept, alen)) {
+		snprintf(errbuf, errlen, "WebSocket handshake failed (Sec-WebSocket-Accept mismatch)");
+		return -1;
+	}
+
+	size_t hlen = end + 4 - ws->buf;
+	memmove(ws->buf, ws->buf + hlen, ws->len - hlen);
+	ws->len -= hlen;
+	return 0;
+}
+
+// 受信バッファから完結したフレームを取り出して処理する,切断すべきなら0以外
+static int ws_process_frames(struct nano_ws *ws, nano_ws_handler handler, void *user, int *closed)
+{
+	size_t off = 0;
+	int result = 0;
+
+	while(!result) {
+		unsigned char *p = (unsigned char *)ws->buf + off;
+		size_t avail = ws->len - off;
+		size_t hlen = 2;
+		uint64_t plen;
+
+		if(avail < 2) break;
+		int fin = p[0] & 0x80;
+		int opcode = p[0] & 0x0f;
+		int masked = p[1] & 0x80;
+		plen = p[1] & 0x7f;
+		if(plen == 126) {
+			hlen += 2;
+			if(avail < hlen) break;
+			plen = ((uint64_t)p[2] << 8) | p[3];
+		} else if(plen == 127) {
+			hlen += 8;
+			if(avail < hlen) break;
+			plen = 0;
+			for(int i = 0; i < 8; i++) plen = (plen << 8) | p[2 + i];
+		}
+		if(masked) hlen += 4;
+		if(plen > WS_MAX_MESSAGE) {
+			result = -1;
+			break;
+		}
+		if(avail < hlen + plen) break;
+
+		char *payload = (char *)p + hlen;
+		if(masked) {
+			unsigned char *mask = p + hlen - 4;
+			for(uint64_t i = 0; i < plen; i++) payload[i] ^= mask[i & 3];
+		}
+
+		switch(opcode) {
+		case WS_OP_PING:
+			if(!ws_send_frame(ws, WS_OP_PONG, payload, plen)) result = -1;
+			break;
+		case WS_OP_PONG:
+			break;
+		case WS_OP_CLOSE:
+			ws_send_frame(ws, WS_OP_CLOSE, payload, plen > 2 ? 2 : plen);
+			*closed = 1;
+			result = 1;
+			break;
+		default:
+			if(opcode != WS_OP_CONT) {
+				ws->msg_opcode = opcode;
+				ws->msg_len = 0;
+			}
+			if(fin && opcode != WS_OP_CONT) {
+				// 断片化されていなければ受信バッファ上でそのまま渡す
+				char save = payload[plen];
+				payload[plen] = 0;
+				ws->messages++;
+				handler(opcode, payload, plen, user);
+				payload[plen] = save;
+			} else {
+				if(ws->msg_len + plen > WS_MAX_MESSAGE || !ws_reserve(&ws->msg, &ws->msg_cap, ws->msg_len + plen + 1)) {
+					result = -1;
+					break;
+				}
+				memcpy(ws->msg + ws->msg_len, payload, plen);
+				ws->msg_len += plen;
+				if(fin) {
+					ws->msg[ws->msg_len] = 0;
+					ws->messages++;
+					handler(ws->msg_opcode, ws->msg, ws->msg_len, user);
+					ws->msg_len = 0;
+				}
+			}
+			break;
+		}
+		off += hlen + plen;
+	}
+
+	memmove(ws->buf, ws->buf + off, ws->len - off);
+	ws->len -= off;
+	return result;
+}
+
+int nano_ws_run(struct nano_ws *ws, nano_ws_handler handler, void *user, int stall_sec, char *errbuf, size_t errlen)
+{
+	int closed = 0;
+	time_t last = time(NULL);
+
+	// 接続直後に届いていた分
+	if(ws->len > 0 && ws_process_frames(ws, handler, user, &closed)) return closed ? 0 : -1;
+
+	while(1) {
+		size_t got = 0;
+		if(!ws_reserve(&ws->buf, &ws->cap, ws->len + 16384 + 1)) return -1;
+		CURLcode ret = curl_easy_recv(ws->hnd, ws->buf + ws->len, ws->cap - ws->len - 1, &got);
+
+		if(ret == CURLE_AGAIN) {
+			if(time(NULL) - last >= stall_sec) {
+				snprintf(errbuf, errlen, "No data received for %d seconds", stall_sec);
+				return -1;
+			}
+			ws_wait(ws, POLLIN, 1000);
+			continue;
+		}
+		if(ret != CURLE_OK) {
+			snprintf(errbuf, errlen, "%s", curl_easy_strerror(ret));
+			return -1;
+		}
+		if(got == 0) {
+			snprintf(errbuf, errlen, "connection closed");
+			return -1;
+		}
+
+		last = time(NULL);
+		ws->len += got;
+		ws->bytes += got;
+		int r = ws_process_frames(ws, handler, user, &closed);
+		if(r) {
+			if(!closed) snprintf(errbuf, errlen, "WebSocket protocol error");
+			return closed ? 0 : -1;
+		}
+	}
+}
+
+void nano_ws_free(struct nano_ws *ws)
+{
+	free(ws->buf);
+	free(ws->msg);
+	ws->buf = ws->msg = NULL;
+	ws->len = ws->cap = ws->msg_len = ws->msg_cap = 0;
+}
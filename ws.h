@@ -0,0 +1,48 @@
+#ifndef NANOTODON_WS_H
+#define NANOTODON_WS_H
+
+#include <curl/curl.h>
+
+#define NANO_WS_TEXT 0x1
+#define NANO_WS_BINARY 0x2
+
+// 受信したメッセージ(断片化されたものは連結済み,NUL終端済み)
+typedef void (*nano_ws_handler)(int opcode, char *data, size_t len, void *user);
+
+// libcurlのCONNECT_ONLY接続上でWebSocketを話す
+// (libcurl自体のWebSocket対応が無い環境でも動くように自前でフレームを組み立てる)
+struct nano_ws {
+	CURL *hnd;
+	curl_socket_t sock;
+
+	char *buf;		// 受信バッファ
+	size_t len;
+	size_t cap;
+
+	char *msg;		// 断片化されたメッセージの組み立て用
+	size_t msg_len;
+	size_t msg_cap;
+	int msg_opcode;
+
+	unsigned long long bytes;	// 受信バイト数
+	unsigned long long messages;	// ハンドラに渡したメッセージ数
+};
+
+// hndにはURL(https://host/path)などを設定済みであること
+// Upgradeリクエストにheadersを付けて送る,成功すれば0
+// 101以外の応答やSec-WebSocket-Acceptが送ったキーと合わない応答は失敗にする
+int nano_ws_connect(struct nano_ws *ws, CURL *hnd, const char *host, const char *path, struct curl_slist *headers, char *errbuf, size_t errlen);
+
+int nano_ws_send_text(struct nano_ws *ws, const char *data, size_t len);
+
+// 切断されるまで受信を続ける,stall_sec秒以上何も届かなければ切断とみなす
+// 戻り値はサーバから正常に閉じられたなら0、それ以外は-1
+int nano_ws_run(struct nano_ws *ws, nano_ws_handler handler, void *user, int stall_sec, char *errbuf, size_t errlen);
+
+// Sec-WebSocket-Keyに対するSec-WebSocket-Acceptの値(acceptには29バイト必要)
+void nano_ws_accept_key(const char *key, char *accept);
+
+// 接続は閉じない(hndの後始末は呼び出し側で行う)
+void nano_ws_free(struct nano_ws *ws);
+
+#endif